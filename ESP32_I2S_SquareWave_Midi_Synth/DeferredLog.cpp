@@ -0,0 +1,117 @@
+#include "DeferredLog.h"
+
+DeferredLog synthLog;
+
+struct LogFormat {
+    LogCode code;
+    const char* format;
+};
+
+static const LogFormat LOG_FORMATS[] = {
+    { LOG_NO_FREE_VOICE, "Warning: No free voices! (note %ld)" },
+    { LOG_CANNOT_START_NOTE, "Warning: Cannot start note %ld (freq=%ld, amp=%ld, wl=%ld)" },
+};
+
+DeferredLog::DeferredLog() :
+    write_position(0),
+    read_position(0),
+    dropped_count(0),
+    reported_dropped(0),
+    task_handle(NULL)
+{
+    for (uint32_t i = 0; i < RING_SIZE; ++i) {
+        slots[i].sequence.store(2 * i, std::memory_order_relaxed);
+    }
+}
+
+bool DeferredLog::begin() {
+    if (task_handle != NULL) return true;
+    BaseType_t task_created = xTaskCreatePinnedToCore(
+        printTaskWrapper,   // Static wrapper function
+        "DeferredLogTask",  // Task name
+        4096,               // Stack size (Serial.printf needs some)
+        this,               // Pass instance pointer as parameter
+        1,                  // Low priority: only runs when nothing else needs the core
+        &task_handle,       // Task handle
+        0                   // Core 0, away from the audio task
+    );
+    return task_created == pdPASS;
+}
+
+void DeferredLog::write(LogCode code, int32_t a0, int32_t a1, int32_t a2, int32_t a3) {
+    uint32_t position = write_position.fetch_add(1, std::memory_order_relaxed);
+    Slot* slot = &slots[position & (RING_SIZE - 1)];
+    uint32_t free_sequence = 2 * position;
+    // One attempt: fails if the printer has not emptied the slot yet, or already skipped this position
+    if (!slot->sequence.compare_exchange_strong(free_sequence, 2 * position + 1, std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+        dropped_count.fetch_add(1, std::memory_order_relaxed); // Drop rather than wait
+        return;
+    }
+    slot->record.timestamp_us = micros();
+    slot->record.code = code;
+    slot->record.args[0] = a0;
+    slot->record.args[1] = a1;
+    slot->record.args[2] = a2;
+    slot->record.args[3] = a3;
+    slot->sequence.store(2 * position + 2, std::memory_order_release);
+}
+
+bool DeferredLog::read(Record& out) {
+    while (true) {
+        Slot& slot = slots[read_position & (RING_SIZE - 1)];
+        uint32_t free_sequence = 2 * read_position;
+        uint32_t next_lap = 2 * (read_position + RING_SIZE);
+        uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence == free_sequence + 2) {
+            out = slot.record;
+            slot.sequence.store(next_lap, std::memory_order_release); // Free for the next lap
+            read_position++;
+            return true;
+        }
+        if (sequence != free_sequence) return false; // Being written
+        if ((int32_t)(write_position.load(std::memory_order_relaxed) - read_position) <= 0) return false; // Empty
+        // Reserved but not claimed: its writer found the ring full (and dropped the record),
+        // or has yet to claim it and will now fail and drop it. Skip the position.
+        if (slot.sequence.compare_exchange_strong(sequence, next_lap, std::memory_order_relaxed)) read_position++;
+    }
+}
+
+void DeferredLog::print(const Record& record) {
+    const char* format = nullptr;
+    for (size_t i = 0; i < sizeof(LOG_FORMATS) / sizeof(LOG_FORMATS[0]); ++i) {
+        if (LOG_FORMATS[i].code == record.code) format = LOG_FORMATS[i].format;
+    }
+    Serial.printf("[%lu.%03lu] ", (unsigned long)(record.timestamp_us / 1000000),
+                  (unsigned long)(record.timestamp_us / 1000 % 1000));
+    if (format) {
+        Serial.printf(format, (long)record.args[0], (long)record.args[1], (long)record.args[2], (long)record.args[3]);
+        Serial.println();
+    } else {
+        Serial.printf("Log code %u: %ld %ld %ld %ld\n", record.code, (long)record.args[0],
+                      (long)record.args[1], (long)record.args[2], (long)record.args[3]);
+    }
+}
+
+void DeferredLog::printTaskWrapper(void* instance) {
+    if (instance) {
+        static_cast<DeferredLog*>(instance)->printTaskRunner();
+    }
+    vTaskDelete(NULL);
+}
+
+void DeferredLog::printTaskRunner() {
+    Record record;
+    while (true) {
+        while (read(record)) {
+            print(record);
+        }
+        uint32_t dropped_now = dropped();
+        if (dropped_now != reported_dropped) {
+            Serial.printf("Warning: %lu log records dropped (ring full)\n",
+                          (unsigned long)(dropped_now - reported_dropped));
+            reported_dropped = dropped_now;
+        }
+        vTaskDelay(pdMS_TO_TICKS(PRINT_INTERVAL_MS));
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// --- Log Codes ---
+// Each code has a printf format in DeferredLog.cpp taking up to LOG_MAX_ARGS long arguments
+enum LogCode : uint16_t {
+    LOG_NO_FREE_VOICE = 1,   // note
+    LOG_CANNOT_START_NOTE,   // note, frequency (Hz), amplitude, wavelength
+};
+
+// Deferred binary logging for real-time code.
+//
+// write() copies a code and a few integer arguments into a fixed ring and returns:
+// no formatting, no UART, no allocation, no locks, so it is safe while holding
+// voicesMutex or inside the audio task. A low-priority task started by begin()
+// formats and prints the records. When the ring is full the record is dropped
+// and counted; the printer reports drops.
+//
+// Ring: bounded multi-producer queue with a sequence number per slot. write() is
+// wait-free: it reserves a position with one fetch_add and claims that position's
+// slot with one compare-and-swap, without retrying. If the slot still holds an
+// unprinted record from the previous lap, the new record is dropped. The printer
+// skips reserved positions whose slot was never claimed. A writer that is
+// interrupted between its reservation and its claim while the printer reaches
+// that position also drops its record.
+class DeferredLog {
+public:
+    static const uint8_t LOG_MAX_ARGS = 4;
+    static const uint16_t RING_SIZE = 64;      // Power of two
+    static const uint32_t PRINT_INTERVAL_MS = 20;
+
+    DeferredLog();
+
+    // Start the printing task (low priority, core 0). Records written before
+    // this are kept until the ring is full.
+    bool begin();
+
+    void write(LogCode code, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0);
+
+    uint32_t dropped() const { return dropped_count.load(std::memory_order_relaxed); }
+
+private:
+    struct Record {
+        uint32_t timestamp_us;
+        uint16_t code;
+        int32_t args[LOG_MAX_ARGS];
+    };
+    struct Slot {
+        // For position p: 2p free for its writer, 2p + 1 being written, 2p + 2 ready to print
+        std::atomic<uint32_t> sequence;
+        Record record;
+    };
+
+    Slot slots[RING_SIZE];
+    std::atomic<uint32_t> write_position;
+    uint32_t read_position;             // Printer task only
+    std::atomic<uint32_t> dropped_count;
+    uint32_t reported_dropped;          // Printer task only
+    TaskHandle_t task_handle;
+
+    bool read(Record& out);
+    void print(const Record& record);
+    void printTaskRunner();
+    static void printTaskWrapper(void* instance);
+};
+
+// Used by the synth engine; the sketch calls synthLog.begin() in setup()
+extern DeferredLog synthLog;
+
+#endif // DEFERRED_LOG_H
@@ -2,6 +2,25 @@
 #include "Synthesizer.h" // Synth engine
 #include "SongData.h"    // Song definitions and song_list
 #include "MidiPlayer.h"  // MIDI playback logic
+#include "SynthBenchmark.h" // Optional benchmarks
+#include "RenderCheck.h"    // Optional golden-render check
+#include "DeferredLog.h"    // Prints warnings from the real-time code
+#include "SynthTrace.h"     // Optional timing traces (enable in SynthTrace.h)
+
+// Set to 1 to print benchmark results (lines starting with "BENCH ") before playback
+#define RUN_BENCHMARKS 0
+// Set to 1 to render every song offline and compare it with the golden hashes
+#define RUN_RENDER_CHECK 0
+// Set to 1 to print audio task load, underruns and the recommended DMA buffers every few seconds while playing
+#define PRINT_SYNTH_STATS 0
+const unsigned long SYNTH_STATS_INTERVAL_MS = 5000;
+
+// Output sample rate, render-ahead depth and DMA buffers between the audio tasks and the DAC.
+// The default buffers (8 x 1024 frames, ~186 ms) are safe; for live input use the smaller values
+// PRINT_SYNTH_STATS recommends. A lower sample_rate (e.g. 22050) roughly halves the render CPU time;
+// oversampling = 2 or 4 removes most of the aliasing of high notes for about that much more.
+// output_config.master.order switches on the master effects, e.g. { MASTER_DC_BLOCKER, MASTER_TONE, MASTER_ECHO }.
+SynthOutputConfig output_config;
 
 // --- Global Objects ---
 Synthesizer synth;
@@ -12,9 +31,12 @@ void setup() {
     Serial.begin(115200);
     while (!Serial);
     Serial.println("\nESP32 Refactored MIDI Player");
+    if (!synthLog.begin()) {
+        Serial.println("Warning: Failed to start the log task, synth warnings will not be printed.");
+    }
 
     // 1. Initialize the Synthesizer (starts I2S, audio task)
-    if (!synth.init()) {
+    if (!synth.init(output_config)) {
         Serial.println("FATAL: Synthesizer initialization failed!");
         while (true); // Halt
     }
@@ -24,6 +46,13 @@ void setup() {
     player.init(synth);
     Serial.println("MIDI Player Initialized.");
 
+#if RUN_BENCHMARKS
+    runSynthBenchmarks(synth, song_list, SONG_COUNT);
+#endif
+#if RUN_RENDER_CHECK
+    runRenderCheck(song_list, SONG_COUNT, synth.sampleRate());
+#endif
+
     // 3. Select a Random Song from the list in SongData.h
     if (SONG_COUNT == 0) {
         Serial.println("Error: SONG_COUNT is zero in SongData.h!");
@@ -53,9 +82,36 @@ void loop() {
     // The player handles timing and event processing internally.
     bool still_playing = player.update();
 
+#if PRINT_SYNTH_STATS
+    static unsigned long last_stats_ms = 0;
+    if (millis() - last_stats_ms >= SYNTH_STATS_INTERVAL_MS) {
+        last_stats_ms = millis();
+        SynthStats stats;
+        synth.getStats(stats);
+        Serial.printf("Synth: load %.1f%% (peak %.1f%%), %lu underruns, %lu blocks\n",
+                      stats.load_percent, stats.peak_load_percent,
+                      (unsigned long)stats.underruns, (unsigned long)stats.blocks);
+        Serial.printf("Synth: render-ahead slack min %lu us, avg %lu us, %lu blocks starved\n",
+                      (unsigned long)stats.min_slack_us, (unsigned long)stats.avg_slack_us,
+                      (unsigned long)stats.starved_blocks);
+        if (output_config.master.order[0] != MASTER_STAGE_NONE) {
+            Serial.printf("Synth: master chain cycles per block: dc %lu, tone %lu, echo %lu\n",
+                          (unsigned long)stats.avg_master_cycles[MASTER_DC_BLOCKER],
+                          (unsigned long)stats.avg_master_cycles[MASTER_TONE],
+                          (unsigned long)stats.avg_master_cycles[MASTER_ECHO]);
+        }
+        SynthOutputConfig recommended = synth.recommendedOutputConfig();
+        Serial.printf("Synth: recommended DMA buffers %d x %d frames, latency up to %lu us\n",
+                      recommended.dma_buf_count, recommended.dma_buf_len,
+                      (unsigned long)Synthesizer::worstCaseLatencyMicros(recommended));
+        synth.resetStats(); // Peak per interval
+    }
+#endif
+
     if (!still_playing) {
         // Song has finished (or was stopped)
         Serial.println("Playback complete or stopped. Halting in main loop.");
+        SYNTH_TRACE_DUMP(); // Last RING_SIZE trace entries, see traceToChrome.py
         Serial.flush();
         // Halt execution - the player indicated it's done.
         while (true) {
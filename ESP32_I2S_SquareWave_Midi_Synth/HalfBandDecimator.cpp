@@ -0,0 +1,61 @@
+#include "HalfBandDecimator.h"
+
+// Side taps at offsets +-1, +-3, ... from the center, Q15; each set sums to 8192 so
+// that 2 * sum + the 16384 center tap is exactly 1.0.
+static const int16_t SHARP_COEFFICIENTS[] = { 10361, -3268, 1754, -1055, 648, -388, 220, -114, 51, -17 };
+static const int16_t SHORT_COEFFICIENTS[] = { 9989, -2335, 638, -100 };
+static const int32_t CENTER_TAP_Q15 = 16384;
+
+static uint8_t filterTaps(HalfBandDecimator::Filter filter, const int16_t** coefficients) {
+    if (filter == HalfBandDecimator::FILTER_SHORT) {
+        *coefficients = SHORT_COEFFICIENTS;
+        return sizeof(SHORT_COEFFICIENTS) / sizeof(SHORT_COEFFICIENTS[0]);
+    }
+    *coefficients = SHARP_COEFFICIENTS;
+    return sizeof(SHARP_COEFFICIENTS) / sizeof(SHARP_COEFFICIENTS[0]);
+}
+
+HalfBandDecimator::HalfBandDecimator(Filter filter) {
+    pairs = filterTaps(filter, &coefficients);
+    history_length = 4 * pairs - 2;
+    reset();
+}
+
+void HalfBandDecimator::reset() {
+    memset(buffer, 0, sizeof(buffer));
+}
+
+void HalfBandDecimator::decimate(size_t input_count, int16_t* out, size_t out_stride) {
+    if (input_count > MAX_INPUT) input_count = MAX_INPUT;
+    const int center = 2 * pairs - 1;
+    for (size_t n = 0; n < input_count / 2; ++n) {
+        // Window of 4 * pairs - 1 samples ending at input 2n + 1
+        const int16_t* window = buffer + 2 * n + 1;
+        int32_t acc = CENTER_TAP_Q15 * window[center];
+        for (int j = 0; j < pairs; ++j) {
+            int offset = 2 * j + 1;
+            acc += coefficients[j] * (window[center - offset] + window[center + offset]);
+        }
+        acc = (acc + 16384) >> 15;
+        if (acc > 32767) acc = 32767;
+        if (acc < -32768) acc = -32768;
+        out[n * out_stride] = (int16_t)acc;
+    }
+    // Keep the newest samples as history for the next call
+    memmove(buffer, buffer + input_count, history_length * sizeof(int16_t));
+}
+
+double HalfBandDecimator::response(Filter filter, double omega) {
+    const int16_t* taps;
+    uint8_t count = filterTaps(filter, &taps);
+    double gain = CENTER_TAP_Q15;
+    for (int j = 0; j < count; ++j) {
+        gain += 2.0 * taps[j] * cos(omega * (2 * j + 1));
+    }
+    return gain / 32768.0;
+}
+
+int HalfBandDecimator::delay(Filter filter) {
+    const int16_t* taps;
+    return 2 * filterTaps(filter, &taps) - 2;
+}
@@ -0,0 +1,53 @@
+#ifndef HALF_BAND_DECIMATOR_H
+#define HALF_BAND_DECIMATOR_H
+
+#include <Arduino.h>
+
+// Fixed-point half-band FIR that halves the sample rate, for the synth's oversampling.
+//
+// A half-band filter has every other tap zero apart from the 0.5 center tap, and is
+// symmetric, so each output costs one multiply per pair of nonzero taps and only the
+// kept (even) outputs are computed: the polyphase form. Coefficients are Q15 and sum
+// to exactly 1.0, so DC and a held level pass unchanged. 32-bit accumulation, rounded
+// and saturated to int16.
+//
+// Filters (Kaiser-windowed sinc, response relative to the input rate):
+//   FILTER_SHARP: 39 taps, flat to 0.2, >62 dB down from 0.3. The last 2x stage.
+//   FILTER_SHORT: 15 taps, flat to 0.125, >63 dB down from 0.375. The first stage of
+//                 4x, where everything between the two bands is removed by the next one.
+// Samples are written straight into input(), after the history the filter needs from
+// the previous call, so no copy is made. Not thread-safe: the synth uses it under its mutex.
+class HalfBandDecimator {
+public:
+    enum Filter { FILTER_SHARP, FILTER_SHORT };
+    static const uint8_t MAX_PAIRS = 10;                   // FILTER_SHARP: 4 * 10 - 1 taps
+    static const size_t MAX_INPUT = 256;                   // Samples per decimate() call
+    static const size_t MAX_HISTORY = 4 * MAX_PAIRS - 2;
+
+    explicit HalfBandDecimator(Filter filter = FILTER_SHARP);
+
+    // Clear the history, as if the input had been silent
+    void reset();
+
+    // Where the next up to MAX_INPUT input samples go
+    int16_t* input() { return buffer + history_length; }
+
+    // Filter input_count samples (even, at most MAX_INPUT) from input() into
+    // input_count / 2 outputs, written out_stride samples apart (2 = one channel of
+    // interleaved stereo). Output n is centered on input 2n - (2 * pairs - 2) counted
+    // from the first sample after reset().
+    void decimate(size_t input_count, int16_t* out, size_t out_stride);
+
+    // Zero-phase gain of a filter at omega radians per input sample, and the input
+    // samples an output lags behind (2 * pairs - 2): for measuring the chain offline.
+    static double response(Filter filter, double omega);
+    static int delay(Filter filter);
+
+private:
+    const int16_t* coefficients; // Nonzero side taps, center outwards
+    uint8_t pairs;
+    uint8_t history_length;      // 4 * pairs - 2
+    int16_t buffer[MAX_HISTORY + MAX_INPUT];
+};
+
+#endif // HALF_BAND_DECIMATOR_H
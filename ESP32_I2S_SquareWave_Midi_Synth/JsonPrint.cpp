@@ -0,0 +1,11 @@
+#include "JsonPrint.h"
+
+void printJsonString(const char* text) {
+    Serial.print("\"");
+    for (const char* c = text ? text : ""; *c; ++c) {
+        if (*c == '"' || *c == '\\') Serial.print("\\");
+        char ch[2] = { *c, 0 };
+        Serial.print(ch);
+    }
+    Serial.print("\"");
+}
@@ -0,0 +1,10 @@
+#ifndef JSON_PRINT_H
+#define JSON_PRINT_H
+
+#include <Arduino.h>
+
+// Print text to Serial as a quoted JSON string, escaping quotes and backslashes.
+// Shared by the "BENCH " and "RENDER " result lines; NULL prints "".
+void printJsonString(const char* text);
+
+#endif // JSON_PRINT_H
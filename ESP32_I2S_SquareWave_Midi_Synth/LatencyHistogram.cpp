@@ -0,0 +1,34 @@
+#include "LatencyHistogram.h"
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+void LatencyHistogram::record(uint32_t latency_us) {
+    uint8_t bucket = latency_us ? 32 - __builtin_clz(latency_us) : 0;
+    buckets[bucket]++;
+    total++;
+    if (latency_us > max_us) max_us = latency_us;
+}
+
+void LatencyHistogram::reset() {
+    memset(buckets, 0, sizeof(buckets));
+    total = 0;
+    max_us = 0;
+}
+
+uint32_t LatencyHistogram::percentile(uint8_t percent) const {
+    if (total == 0) return 0;
+    // Rank of the sample at this percentile, 1-based and rounded up
+    uint32_t rank = (uint32_t)(((uint64_t)total * percent + 99) / 100);
+    if (rank == 0) rank = 1;
+    uint32_t seen = 0;
+    for (uint8_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= rank) {
+            uint32_t upper = bucket == 0 ? 0 : (uint32_t)((1ULL << bucket) - 1);
+            return upper < max_us ? upper : max_us;
+        }
+    }
+    return max_us;
+}
@@ -0,0 +1,35 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <Arduino.h>
+
+// Fixed-size log2 histogram of latencies in microseconds.
+//
+// Bucket 0 holds 0 us, bucket b holds [2^(b-1), 2^b) us, so 33 buckets cover the
+// whole uint32_t range. record() is a few instructions: no allocation, no locks,
+// no Serial. Not thread-safe: record and query from the same task.
+class LatencyHistogram {
+public:
+    static const uint8_t BUCKET_COUNT = 33;
+
+    LatencyHistogram();
+
+    void record(uint32_t latency_us);
+    void reset();
+
+    uint32_t count() const { return total; }
+    uint32_t max() const { return max_us; }
+    uint32_t bucketCount(uint8_t bucket) const { return bucket < BUCKET_COUNT ? buckets[bucket] : 0; }
+
+    // Upper bound of the bucket holding the given percentile (capped at max()), 0 if empty
+    uint32_t percentile(uint8_t percent) const;
+    uint32_t p50() const { return percentile(50); }
+    uint32_t p99() const { return percentile(99); }
+
+private:
+    uint32_t buckets[BUCKET_COUNT];
+    uint32_t total;
+    uint32_t max_us;
+};
+
+#endif // LATENCY_HISTOGRAM_H
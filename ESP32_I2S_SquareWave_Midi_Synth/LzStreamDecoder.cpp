@@ -0,0 +1,72 @@
+#include "LzStreamDecoder.h"
+#include <pgmspace.h> // For PROGMEM read functions
+
+LzStreamDecoder::LzStreamDecoder() :
+    src(nullptr),
+    write_pos(0),
+    literal_remaining(0),
+    match_remaining(0),
+    match_pos(0)
+{}
+
+void LzStreamDecoder::begin(const uint8_t* compressed_progmem_addr) {
+    src = compressed_progmem_addr;
+    write_pos = 0;
+    literal_remaining = 0;
+    match_remaining = 0;
+    match_pos = 0;
+}
+
+void LzStreamDecoder::read(uint8_t* out, uint8_t count) {
+    for (uint8_t i = 0; i < count; ++i) {
+        out[i] = nextByte();
+    }
+}
+
+bool LzStreamDecoder::checkStream(const uint8_t* compressed_progmem_addr, uint32_t compressed_size, uint32_t output_size) {
+    uint32_t pos = 0;
+    uint32_t decoded = 0;
+    while (decoded < output_size) {
+        if (pos >= compressed_size) return false; // Token missing
+        uint8_t token = pgm_read_byte_near(compressed_progmem_addr + pos++);
+        uint32_t run;
+        if (token & 0x80) {
+            if (pos >= compressed_size) return false; // Distance byte missing
+            uint32_t distance = (uint32_t)pgm_read_byte_near(compressed_progmem_addr + pos++) + 1;
+            if (distance > decoded) return false; // Would copy from before the start
+            run = (token & 0x7F) + MIN_MATCH;
+        } else {
+            run = (uint32_t)token + 1;
+            if (compressed_size - pos < run) return false; // Literals run off the end
+            pos += run;
+        }
+        decoded += run;
+    }
+    return true;
+}
+
+uint8_t LzStreamDecoder::nextByte() {
+    // Start a new token once the previous run is used up
+    if (literal_remaining == 0 && match_remaining == 0) {
+        uint8_t token = pgm_read_byte_near(src++);
+        if (token & 0x80) {
+            match_remaining = (token & 0x7F) + MIN_MATCH;
+            uint8_t distance_minus_one = pgm_read_byte_near(src++);
+            match_pos = write_pos - distance_minus_one - 1; // uint8_t arithmetic wraps in the window
+        } else {
+            literal_remaining = token + 1;
+        }
+    }
+
+    uint8_t value;
+    if (literal_remaining > 0) {
+        value = pgm_read_byte_near(src++);
+        literal_remaining--;
+    } else {
+        value = window[match_pos++];
+        match_remaining--;
+    }
+
+    window[write_pos++] = value;
+    return value;
+}
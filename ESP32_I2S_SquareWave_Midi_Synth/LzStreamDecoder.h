@@ -0,0 +1,44 @@
+#ifndef LZ_STREAM_DECODER_H
+#define LZ_STREAM_DECODER_H
+
+#include <Arduino.h>
+
+// Streaming decoder for LZ-compressed song event data stored in PROGMEM.
+//
+// Stream format (produced by myMidiParse2.py --compress):
+//   token 0x00-0x7F : literal run, (token + 1) raw bytes follow
+//   token 0x80-0xFF : match of (token & 0x7F) + 3 bytes, next byte = distance - 1
+// Matches copy from the last WINDOW_SIZE decoded bytes, which live in a small
+// ring buffer, so the song is never copied into RAM as a whole.
+// Each output byte costs at most one token read, so decoding an event is bounded.
+class LzStreamDecoder {
+public:
+    static const uint16_t WINDOW_SIZE = 256; // Must stay 256: positions wrap as uint8_t
+    static const uint8_t MIN_MATCH = 3;
+
+    LzStreamDecoder();
+
+    // Restart decoding at the beginning of a compressed stream
+    void begin(const uint8_t* compressed_progmem_addr);
+
+    // Decode the next 'count' bytes into 'out'
+    void read(uint8_t* out, uint8_t count);
+
+    // Walk the tokens of a stream without decoding it: true if 'output_size' bytes
+    // can be decoded from 'compressed_size' bytes and every match points into data
+    // already decoded. read() itself trusts the stream, so check it once when the
+    // song is loaded instead of on every byte.
+    static bool checkStream(const uint8_t* compressed_progmem_addr, uint32_t compressed_size, uint32_t output_size);
+
+private:
+    uint8_t nextByte();
+
+    const uint8_t* src;     // Next compressed byte in PROGMEM
+    uint8_t window[WINDOW_SIZE];
+    uint8_t write_pos;      // Wraps naturally at WINDOW_SIZE
+    uint8_t literal_remaining;
+    uint8_t match_remaining;
+    uint8_t match_pos;
+};
+
+#endif // LZ_STREAM_DECODER_H
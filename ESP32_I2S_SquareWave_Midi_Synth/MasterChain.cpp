@@ -0,0 +1,279 @@
+#include "MasterChain.h"
+#include <cmath>            // For cosf, sinf, powf
+#include "esp_heap_caps.h"  // For placing the echo line in PSRAM
+
+static inline int16_t saturate16(int32_t value) {
+    if (value > 32767) return 32767;
+    if (value < -32768) return -32768;
+    return (int16_t)value;
+}
+
+MasterChain::MasterChain() :
+    stage_count(0),
+    channels(1),
+    dc_pole_q15(0),
+    tone_b0(16384), tone_b1(0), tone_b2(0), tone_a1(0), tone_a2(0),
+    echo_line(NULL),
+    echo_length(0),
+    echo_position(0),
+    echo_feedback_q15(0),
+    echo_mix_q15(0)
+{
+    reset();
+}
+
+MasterChain::~MasterChain() {
+    freeEcho();
+}
+
+bool MasterChain::begin(const MasterChainConfig& config, float sample_rate, int channel_count) {
+    stage_count = 0; // Bypassed until everything checks out
+    freeEcho();
+    if (channel_count < 1 || channel_count > 2 || sample_rate <= 0.0f) {
+        Serial.println("Error: Master chain needs 1 or 2 channels and a sample rate.");
+        return false;
+    }
+    channels = (uint8_t)channel_count;
+    chain_config = config;
+
+    uint8_t count = 0;
+    bool used[MASTER_STAGE_COUNT] = {};
+    for (int i = 0; i < MASTER_STAGE_COUNT && config.order[i] != MASTER_STAGE_NONE; ++i) {
+        MasterStage stage = config.order[i];
+        if (stage >= MASTER_STAGE_COUNT || used[stage]) {
+            Serial.printf("Error: Master chain order lists an unknown or repeated stage (%d).\n", (int)stage);
+            return false;
+        }
+        used[stage] = true;
+        stages[count++] = stage;
+    }
+
+    if (used[MASTER_DC_BLOCKER]) {
+        if (config.dc_cutoff_hz <= 0.0f || config.dc_cutoff_hz >= sample_rate / 4) {
+            Serial.printf("Error: DC blocker cutoff %.1f Hz out of range.\n", config.dc_cutoff_hz);
+            return false;
+        }
+        // Pole at 1 - 2 pi fc / fs: the usual approximation, close for cutoffs far below the rate
+        dc_pole_q15 = constrain(lroundf(32768.0f * (1.0f - TWO_PI * config.dc_cutoff_hz / sample_rate)), 0L, 32767L);
+    }
+    if (used[MASTER_TONE] && !setupTone(sample_rate)) {
+        return false;
+    }
+    if (used[MASTER_ECHO]) {
+        if (config.echo_delay_ms < 1 || config.echo_delay_ms > MASTER_MAX_ECHO_MS) {
+            Serial.printf("Error: Echo delay %lu ms outside 1-%lu ms.\n", (unsigned long)config.echo_delay_ms,
+                          (unsigned long)MASTER_MAX_ECHO_MS);
+            return false;
+        }
+        if (config.echo_feedback < 0.0f || config.echo_feedback > MASTER_MAX_ECHO_FEEDBACK
+            || config.echo_mix < 0.0f || config.echo_mix > 1.0f) {
+            Serial.printf("Error: Echo feedback %.2f (0-%.2f) or mix %.2f (0-1) out of range.\n",
+                          config.echo_feedback, MASTER_MAX_ECHO_FEEDBACK, config.echo_mix);
+            return false;
+        }
+        echo_feedback_q15 = lroundf(config.echo_feedback * 32767.0f);
+        echo_mix_q15 = lroundf(config.echo_mix * 32767.0f);
+        size_t frames = (size_t)lroundf(config.echo_delay_ms * sample_rate / 1000.0f);
+        if (!allocateEcho((frames > 0 ? frames : 1) * channels)) {
+            return false;
+        }
+    }
+
+    stage_count = count;
+    reset();
+    if (stage_count == 0) {
+        Serial.println("- Master chain: off.");
+        return true;
+    }
+    Serial.print("- Master chain:");
+    for (uint8_t i = 0; i < stage_count; ++i) {
+        Serial.printf(i ? " > %s" : " %s", stageName(stages[i]));
+    }
+    Serial.println(".");
+    return true;
+}
+
+void MasterChain::reset() {
+    memset(dc, 0, sizeof(dc));
+    memset(tone, 0, sizeof(tone));
+    if (echo_line != NULL) {
+        memset(echo_line, 0, echo_length * sizeof(int16_t));
+    }
+    echo_position = 0;
+}
+
+const char* MasterChain::stageName(MasterStage stage) {
+    switch (stage) {
+        case MASTER_DC_BLOCKER: return "dc";
+        case MASTER_TONE: return "tone";
+        case MASTER_ECHO: return "echo";
+        default: return "none";
+    }
+}
+
+void MasterChain::process(int16_t* samples, size_t frames, uint32_t* stage_cycles) {
+    if (stage_cycles != NULL) {
+        memset(stage_cycles, 0, MASTER_STAGE_COUNT * sizeof(uint32_t));
+    }
+    for (uint8_t i = 0; i < stage_count; ++i) {
+        uint32_t start_cycles = ESP.getCycleCount();
+        switch (stages[i]) {
+            case MASTER_DC_BLOCKER: processDcBlocker(samples, frames); break;
+            case MASTER_TONE: processTone(samples, frames); break;
+            case MASTER_ECHO: processEcho(samples, frames * channels); break;
+            default: break;
+        }
+        if (stage_cycles != NULL) {
+            stage_cycles[stages[i]] = ESP.getCycleCount() - start_cycles;
+        }
+    }
+}
+
+// --- Private Helper Methods ---
+
+bool MasterChain::setupTone(float sample_rate) {
+    const MasterChainConfig& config = chain_config;
+    if (config.tone_frequency_hz <= 0.0f || config.tone_frequency_hz >= sample_rate / 2 || config.tone_q <= 0.0f
+        || fabsf(config.tone_gain_db) > MASTER_MAX_TONE_GAIN_DB) {
+        Serial.printf("Error: Tone %.0f Hz, Q %.2f, %.1f dB out of range.\n", config.tone_frequency_hz,
+                      config.tone_q, config.tone_gain_db);
+        return false;
+    }
+    // Audio EQ Cookbook (R. Bristow-Johnson)
+    float w0 = TWO_PI * config.tone_frequency_hz / sample_rate;
+    float cos_w0 = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * config.tone_q);
+    float A = powf(10.0f, config.tone_gain_db / 40.0f);
+    float shelf = 2.0f * sqrtf(A) * alpha;
+    float b0, b1, b2, a0, a1, a2;
+    switch (config.tone_type) {
+        case MASTER_TONE_LOW_SHELF:
+            b0 = A * ((A + 1) - (A - 1) * cos_w0 + shelf);
+            b1 = 2 * A * ((A - 1) - (A + 1) * cos_w0);
+            b2 = A * ((A + 1) - (A - 1) * cos_w0 - shelf);
+            a0 = (A + 1) + (A - 1) * cos_w0 + shelf;
+            a1 = -2 * ((A - 1) + (A + 1) * cos_w0);
+            a2 = (A + 1) + (A - 1) * cos_w0 - shelf;
+            break;
+        case MASTER_TONE_HIGH_SHELF:
+            b0 = A * ((A + 1) + (A - 1) * cos_w0 + shelf);
+            b1 = -2 * A * ((A - 1) + (A + 1) * cos_w0);
+            b2 = A * ((A + 1) + (A - 1) * cos_w0 - shelf);
+            a0 = (A + 1) - (A - 1) * cos_w0 + shelf;
+            a1 = 2 * ((A - 1) - (A + 1) * cos_w0);
+            a2 = (A + 1) - (A - 1) * cos_w0 - shelf;
+            break;
+        case MASTER_TONE_PEAK:
+            b0 = 1 + alpha * A;
+            b1 = -2 * cos_w0;
+            b2 = 1 - alpha * A;
+            a0 = 1 + alpha / A;
+            a1 = -2 * cos_w0;
+            a2 = 1 - alpha / A;
+            break;
+        case MASTER_TONE_LOW_PASS:
+            b0 = (1 - cos_w0) / 2;
+            b1 = 1 - cos_w0;
+            b2 = (1 - cos_w0) / 2;
+            a0 = 1 + alpha;
+            a1 = -2 * cos_w0;
+            a2 = 1 - alpha;
+            break;
+        default:
+            Serial.printf("Error: Unknown tone type %d.\n", (int)config.tone_type);
+            return false;
+    }
+    // Q14 in 32 bits: even a +24 dB shelf (b0 near 16) has room to spare
+    tone_b0 = lroundf(b0 / a0 * 16384.0f);
+    tone_b1 = lroundf(b1 / a0 * 16384.0f);
+    tone_b2 = lroundf(b2 / a0 * 16384.0f);
+    tone_a1 = lroundf(a1 / a0 * 16384.0f);
+    tone_a2 = lroundf(a2 / a0 * 16384.0f);
+    return true;
+}
+
+bool MasterChain::allocateEcho(size_t samples) {
+    size_t bytes = samples * sizeof(int16_t);
+    const char* where = "PSRAM";
+    if (psramFound()) {
+        echo_line = (int16_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (echo_line == NULL) {
+        echo_line = (int16_t*)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        where = "internal RAM";
+    }
+    if (echo_line == NULL) {
+        Serial.printf("Error: Failed to allocate %u bytes for the echo line!\n", (unsigned)bytes);
+        return false;
+    }
+    echo_length = samples;
+    Serial.printf("- Echo line: %lu ms, %u bytes in %s.\n", (unsigned long)chain_config.echo_delay_ms,
+                  (unsigned)bytes, where);
+    return true;
+}
+
+void MasterChain::freeEcho() {
+    if (echo_line != NULL) {
+        heap_caps_free(echo_line);
+        echo_line = NULL;
+    }
+    echo_length = 0;
+    echo_position = 0;
+}
+
+void MasterChain::processDcBlocker(int16_t* samples, size_t frames) {
+    for (int channel = 0; channel < channels; ++channel) {
+        int32_t x_prev = dc[channel].x_prev;
+        int32_t y = dc[channel].y_q8;
+        int16_t* sample = samples + channel;
+        for (size_t n = 0; n < frames; ++n, sample += channels) {
+            int32_t x = *sample;
+            // Divide rather than shift: truncating toward zero lets silence settle at exactly 0
+            y = (x - x_prev) * 256 + (int32_t)((int64_t)y * dc_pole_q15 / 32768);
+            x_prev = x;
+            *sample = saturate16((y + 128) >> 8);
+        }
+        dc[channel].x_prev = x_prev;
+        dc[channel].y_q8 = y;
+    }
+}
+
+void MasterChain::processTone(int16_t* samples, size_t frames) {
+    for (int channel = 0; channel < channels; ++channel) {
+        ToneState state = tone[channel]; // Work on a local copy so it stays in registers
+        int16_t* sample = samples + channel;
+        for (size_t n = 0; n < frames; ++n, sample += channels) {
+            int32_t x = *sample;
+            int64_t acc = (int64_t)tone_b0 * x + (int64_t)tone_b1 * state.x1 + (int64_t)tone_b2 * state.x2
+                        - (int64_t)tone_a1 * state.y1 - (int64_t)tone_a2 * state.y2 + state.error;
+            int32_t y = (int32_t)(acc >> 14);
+            state.error = (int32_t)(acc - (int64_t)y * 16384); // Fed back so rounding does not build up
+            y = saturate16(y);
+            state.x2 = state.x1;
+            state.x1 = x;
+            state.y2 = state.y1;
+            state.y1 = y;
+            *sample = (int16_t)y;
+        }
+        tone[channel] = state;
+    }
+}
+
+void MasterChain::processEcho(int16_t* samples, size_t count) {
+    // In runs up to the end of the line, so the inner loop has no wrap check
+    while (count > 0) {
+        size_t run = echo_length - echo_position;
+        if (run > count) run = count;
+        int16_t* line = echo_line + echo_position;
+        for (size_t i = 0; i < run; ++i) {
+            int32_t x = samples[i];
+            int32_t delayed = line[i];
+            samples[i] = saturate16(x + ((delayed * echo_mix_q15 + 16384) >> 15));
+            line[i] = saturate16(x + ((delayed * echo_feedback_q15 + 16384) >> 15));
+        }
+        samples += run;
+        count -= run;
+        echo_position += run;
+        if (echo_position == echo_length) echo_position = 0;
+    }
+}
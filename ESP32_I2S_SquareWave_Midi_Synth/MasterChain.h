@@ -0,0 +1,107 @@
+#ifndef MASTER_CHAIN_H
+#define MASTER_CHAIN_H
+
+#include <Arduino.h>
+
+// Master bus effects, run in place on every rendered block before it is queued for I2S.
+//
+// Integer only in the audio path: int16 samples saturated after every stage, Q15 gains
+// and Q14 filter coefficients worked out once in begin() from the float parameters.
+// Stages, in whatever order MasterChainConfig::order lists them:
+//   MASTER_DC_BLOCKER: one-pole high-pass (y = x - x[-1] + R * y[-1]) that removes the
+//                      offset a mix of unbalanced square waves carries.
+//   MASTER_TONE:       one RBJ-cookbook biquad (shelf, peak or low-pass) to voice the
+//                      enclosure. Direct form I with the rounding error fed back.
+//   MASTER_ECHO:       feedback delay. The line is allocated once in begin(), in PSRAM
+//                      when the board has it.
+// Stereo blocks are interleaved; the filters keep separate state per channel. An empty
+// order (the default) bypasses the chain entirely. Not thread-safe: the render task owns it.
+enum MasterStage : uint8_t {
+    MASTER_DC_BLOCKER,
+    MASTER_TONE,
+    MASTER_ECHO,
+    MASTER_STAGE_COUNT,
+    MASTER_STAGE_NONE = MASTER_STAGE_COUNT // Ends an order shorter than MASTER_STAGE_COUNT
+};
+
+enum MasterToneType : uint8_t {
+    MASTER_TONE_LOW_SHELF,
+    MASTER_TONE_HIGH_SHELF,
+    MASTER_TONE_PEAK,
+    MASTER_TONE_LOW_PASS
+};
+
+const uint32_t MASTER_MAX_ECHO_MS = 2000;   // 350 KB of stereo line at 44.1 kHz: PSRAM territory
+const float MASTER_MAX_TONE_GAIN_DB = 24.0f;
+const float MASTER_MAX_ECHO_FEEDBACK = 0.95f; // Below 1 so the echo always dies out
+
+// Passed to Synthesizer::init() as SynthOutputConfig::master
+struct MasterChainConfig
+{
+    // Processing order, each stage at most once, e.g. { MASTER_DC_BLOCKER, MASTER_TONE, MASTER_ECHO }
+    MasterStage order[MASTER_STAGE_COUNT] = { MASTER_STAGE_NONE, MASTER_STAGE_NONE, MASTER_STAGE_NONE };
+    float dc_cutoff_hz = 10.0f;        // DC blocker -3 dB point
+    MasterToneType tone_type = MASTER_TONE_HIGH_SHELF;
+    float tone_frequency_hz = 4000.0f; // Shelf midpoint, peak center or low-pass cutoff
+    float tone_gain_db = -6.0f;        // Shelves and peak, up to +-MASTER_MAX_TONE_GAIN_DB
+    float tone_q = 0.707f;
+    uint32_t echo_delay_ms = 300;      // 1 to MASTER_MAX_ECHO_MS
+    float echo_feedback = 0.35f;       // Share of the delayed signal written back, up to MASTER_MAX_ECHO_FEEDBACK
+    float echo_mix = 0.3f;             // Level of the delayed signal in the output, 0-1
+};
+
+class MasterChain {
+public:
+    MasterChain();
+    ~MasterChain();
+
+    // Check the config, work out the coefficients for this rate and allocate the echo
+    // line (channels: 1, or 2 for interleaved stereo). Prints what it set up, or the
+    // reason and returns false. Call before the render task starts.
+    bool begin(const MasterChainConfig& config, float sample_rate, int channels);
+
+    // Clear the filter state and the echo line, as if the input had been silent
+    void reset();
+
+    bool active() const { return stage_count > 0; }
+    const MasterChainConfig& config() const { return chain_config; }
+
+    // Run the stages in order over frames frames. stage_cycles, if given, receives the
+    // cycles each stage took, indexed by MasterStage; stages not in the chain get 0.
+    void process(int16_t* samples, size_t frames, uint32_t* stage_cycles = NULL);
+
+    static const char* stageName(MasterStage stage);
+
+private:
+    MasterChain(const MasterChain&) = delete; // Owns the echo line
+    MasterChain& operator=(const MasterChain&) = delete;
+
+    struct DcState { int32_t x_prev; int32_t y_q8; };   // Output kept with 8 extra bits
+    struct ToneState { int32_t x1, x2, y1, y2, error; };
+
+    MasterChainConfig chain_config;
+    MasterStage stages[MASTER_STAGE_COUNT];
+    uint8_t stage_count;
+    uint8_t channels;
+
+    int32_t dc_pole_q15;
+    DcState dc[2];
+
+    int32_t tone_b0, tone_b1, tone_b2, tone_a1, tone_a2; // Q14, normalized by a0
+    ToneState tone[2];
+
+    int16_t* echo_line;          // Interleaved like the blocks
+    size_t echo_length;          // Samples in the line: delay frames * channels
+    size_t echo_position;
+    int32_t echo_feedback_q15;
+    int32_t echo_mix_q15;
+
+    bool setupTone(float sample_rate);
+    bool allocateEcho(size_t samples);
+    void freeEcho();
+    void processDcBlocker(int16_t* samples, size_t frames);
+    void processTone(int16_t* samples, size_t frames);
+    void processEcho(int16_t* samples, size_t count);
+};
+
+#endif // MASTER_CHAIN_H
@@ -1,15 +1,18 @@
 #include "MidiPlayer.h"
 #include <pgmspace.h> // For PROGMEM read functions
 #include <cmath>      // For roundf
+#include "SynthTrace.h" // Optional timing traces
 
 MidiPlayer::MidiPlayer() :
     synth(nullptr),
     current_song_data_ptr(nullptr),
     current_event_count(0),
     current_bpm(0.0f),
+    current_song_format(SONG_FORMAT_RAW),
     is_playing(false),
     current_event_index(0),
     next_event_time_ms(0),
+    repeat_depth(0),
     millis_per_tick(0.0f)
 {}
 
@@ -27,10 +30,14 @@ bool MidiPlayer::loadSong(const SongInfo* song_info_progmem_addr) {
     // Read song metadata from the PROGMEM address provided
     // Note: Need to read members relative to the base address of the struct in PROGMEM
     current_song_data_ptr = (const uint8_t*)pgm_read_ptr_near(&song_info_progmem_addr->midi_data_ptr);
-    current_event_count = pgm_read_word_near(&song_info_progmem_addr->event_count);
+    current_event_count = pgm_read_dword_near(&song_info_progmem_addr->event_count);
     // Reading float from PROGMEM requires special handling if pgm_read_float_near isn't available/reliable
     // Using memcpy_P is a safe way:
     memcpy_P(&current_bpm, &song_info_progmem_addr->bpm, sizeof(float));
+    current_song_format = pgm_read_byte_near(&song_info_progmem_addr->format);
+    const char* title = (const char*)pgm_read_ptr_near(&song_info_progmem_addr->title);
+    uint32_t duration_ms = pgm_read_dword_near(&song_info_progmem_addr->duration_ms);
+    uint32_t data_size = pgm_read_dword_near(&song_info_progmem_addr->data_size);
 
 
     if (current_song_data_ptr == nullptr || current_event_count == 0) {
@@ -39,13 +46,27 @@ bool MidiPlayer::loadSong(const SongInfo* song_info_progmem_addr) {
         current_event_count = 0;
         return false;
     }
+    if (current_song_format != SONG_FORMAT_RAW && current_song_format != SONG_FORMAT_LZ) {
+        Serial.printf("MidiPlayer Error: Unknown song format %u.\n", current_song_format);
+        current_song_data_ptr = nullptr;
+        current_event_count = 0;
+        return false;
+    }
+    if (!validateSong(data_size)) {
+        current_song_data_ptr = nullptr;
+        current_event_count = 0;
+        return false;
+    }
 
     // Calculate timing for this specific song
     calculateTimingFactors(current_bpm);
 
     Serial.println("--- MidiPlayer Loaded Song Info ---");
-    Serial.printf("  Event Count: %u\n", current_event_count);
+    Serial.printf("  Title: %s\n", title ? title : "(untitled)");
+    Serial.printf("  Duration: %lu:%02lu\n", (unsigned long)(duration_ms / 60000), (unsigned long)(duration_ms / 1000 % 60));
+    Serial.printf("  Event Count: %lu\n", (unsigned long)current_event_count);
     Serial.printf("  BPM: %.2f\n", current_bpm);
+    Serial.printf("  Format: %s\n", current_song_format == SONG_FORMAT_LZ ? "LZ compressed" : "raw");
     Serial.printf("  Millis per Tick: %.4f\n", millis_per_tick);
     Serial.printf("  Data Address: 0x%p\n", current_song_data_ptr);
 
@@ -59,6 +80,10 @@ bool MidiPlayer::loadSong(const SongInfo* song_info_progmem_addr) {
 
 
 void MidiPlayer::start() {
+    startAt(millis());
+}
+
+void MidiPlayer::startAt(unsigned long start_time_ms) {
     if (is_playing) return;
     if (current_event_count == 0 || current_song_data_ptr == nullptr) {
         Serial.println("MidiPlayer Error: Cannot start playback, no valid song loaded.");
@@ -66,13 +91,24 @@ void MidiPlayer::start() {
     }
 
     Serial.println("MidiPlayer: Starting Playback...");
+    calculateTimingFactors(current_bpm); // Undo tempo changes from a previous run
+    if (synth) synth->resetControllers(); // ...and pans
     current_event_index = 0;
+    repeat_depth = 0;
     is_playing = true;
+    resetLatencyStats();
+    if (current_song_format == SONG_FORMAT_LZ) {
+        lz_decoder.begin(current_song_data_ptr);
+    }
 
     // Schedule the very first event
-    uint16_t delta_ticks = pgm_read_uint16_big_endian(current_song_data_ptr);
+    if (!fetchEvent()) {
+        next_event_time_ms = start_time_ms; // Nothing playable, update() will finish
+        return;
+    }
+    uint32_t delta_ticks = readEventDeltaTicks(pending_event);
     unsigned long delta_ms = convertTicksToMillis(delta_ticks);
-    next_event_time_ms = millis() + delta_ms;
+    next_event_time_ms = start_time_ms + delta_ms;
     // Serial.printf("MidiPlayer: First event in %lu ms (ticks: %u)\n", delta_ms, delta_ticks);
 }
 
@@ -93,29 +129,61 @@ bool MidiPlayer::update() {
 
     unsigned long current_time_ms = millis();
 
-    // Check if it's time for the next event
-    if (current_time_ms >= next_event_time_ms) {
+    // Check if it's time for the next event (signed difference survives millis() wrap-around;
+    // 32 bits like the ESP32's unsigned long, so it also holds where unsigned long is wider)
+    if ((int32_t)(uint32_t)(current_time_ms - next_event_time_ms) >= 0) {
 
         // End condition check *before* processing
         if (current_event_index >= current_event_count) {
             Serial.println("\nMidiPlayer: Playback Finished.");
+            Serial.printf("  Dispatch latency us: p50 %lu, p99 %lu, max %lu\n",
+                          (unsigned long)dispatch_latency.p50(), (unsigned long)dispatch_latency.p99(),
+                          (unsigned long)dispatch_latency.max());
+            Serial.printf("  Audible latency us:  p50 %lu, p99 %lu, max %lu\n",
+                          (unsigned long)audible_latency.p50(), (unsigned long)audible_latency.p99(),
+                          (unsigned long)audible_latency.max());
             is_playing = false;
             // Optional: synth->allNotesOff();
             return false; // Indicate finished
         }
 
+        // Ideal time is whole milliseconds on the same clock as micros(); valid until millis() wraps
+        uint32_t late_us = micros() - (uint32_t)(next_event_time_ms * 1000UL);
+        dispatch_latency.record(late_us);
+        if (synth) audible_latency.record(late_us + synth->outputLatencyMicros());
+
         // Process the current event
+        SYNTH_TRACE_BEGIN(TRACE_EVENT_DISPATCH, pending_event[2] & EVENT_TYPE_MASK);
         processCurrentEvent();
+        SYNTH_TRACE_END(TRACE_EVENT_DISPATCH, pending_event[2] & EVENT_TYPE_MASK);
 
-        // Advance index and schedule the *next* event
+        // Advance index and schedule the *next* event on song time, so a late
+        // dispatch does not push every later event back (the latency stays measured
+        // against the ideal time, and late events catch up)
         current_event_index++;
-        scheduleNextEvent(current_time_ms);
+        scheduleNextEvent(next_event_time_ms);
 
     } // End if time for event
 
     return is_playing; // Return true if still playing
 }
 
+void MidiPlayer::resetLatencyStats() {
+    dispatch_latency.reset();
+    audible_latency.reset();
+}
+
+bool MidiPlayer::step() {
+    if (!is_playing || current_event_index >= current_event_count) {
+        is_playing = false;
+        return false;
+    }
+    processCurrentEvent();
+    current_event_index++;
+    scheduleNextEvent(next_event_time_ms); // Song time, not wall-clock time
+    return true;
+}
+
 
 // --- Private Helper Methods ---
 
@@ -130,47 +198,175 @@ void MidiPlayer::calculateTimingFactors(float bpm) {
     }
 }
 
-unsigned long MidiPlayer::convertTicksToMillis(uint16_t ticks) {
-    return (unsigned long)roundf((float)ticks * millis_per_tick);
+// Tempo event: bytes 3-5 hold microseconds per quarter note
+void MidiPlayer::applyTempoEvent(const uint8_t* event) {
+    uint32_t micros_per_quarter = ((uint32_t)event[3] << 16) | ((uint32_t)event[4] << 8) | event[5];
+    if (micros_per_quarter == 0) return;
+    calculateTimingFactors(60000000.0f / (float)micros_per_quarter);
+}
+
+unsigned long MidiPlayer::convertTicksToMillis(uint32_t ticks) {
+    float ms = roundf((float)ticks * millis_per_tick);
+    if (ms >= (float)MAX_DELTA_MS) return MAX_DELTA_MS;
+    return (unsigned long)ms;
 }
 
-uint16_t MidiPlayer::pgm_read_uint16_big_endian(const uint8_t* flash_address) {
-    uint8_t highByte = pgm_read_byte_near(flash_address);
-    uint8_t lowByte = pgm_read_byte_near(flash_address + 1);
-    return ((uint16_t)highByte << 8) | lowByte;
+uint16_t MidiPlayer::read_uint16_big_endian(const uint8_t* address) {
+    return ((uint16_t)address[0] << 8) | address[1];
+}
+
+uint32_t MidiPlayer::readEventDeltaTicks(const uint8_t* event) {
+    uint32_t delta_ticks = read_uint16_big_endian(event); // Offset 0
+    uint8_t event_type = event[2] & EVENT_TYPE_MASK;
+    if (event_type == EVENT_TYPE_LONG_DELTA) {
+        // Extended delta: bytes 3-4 carry the upper 16 bits
+        delta_ticks |= (uint32_t)read_uint16_big_endian(event + 3) << 16;
+    }
+    return delta_ticks;
+}
+
+// One pass over the whole song at load time, so playback can trust every byte
+// without per-event checks: the events fit in the data array, compressed streams
+// decode without running off their array, and every event passes songEventValid
+// (type, note, velocity, repeat, tempo and control ranges, see SongFormat.h).
+bool MidiPlayer::validateSong(uint32_t data_size) {
+    if (current_event_count > 0xFFFFFFFFUL / BYTES_PER_EVENT) {
+        Serial.printf("MidiPlayer Error: Event count %lu is out of range.\n", (unsigned long)current_event_count);
+        return false;
+    }
+    if (data_size == 0) {
+        Serial.println("MidiPlayer Error: Song data size is 0, the events cannot be bounds-checked.");
+        return false;
+    }
+
+    if (current_song_format == SONG_FORMAT_LZ) {
+        if (!LzStreamDecoder::checkStream(current_song_data_ptr, data_size, current_event_count * BYTES_PER_EVENT)) {
+            Serial.printf("MidiPlayer Error: Compressed data (%lu bytes) does not hold %lu events.\n",
+                          (unsigned long)data_size, (unsigned long)current_event_count);
+            return false;
+        }
+        lz_decoder.begin(current_song_data_ptr);
+        for (uint32_t i = 0; i < current_event_count; ++i) {
+            lz_decoder.read(pending_event, BYTES_PER_EVENT);
+            // Checked as event 0, so repeat instructions (unsupported when compressed) fail
+            if (!songEventValid(pending_event, 0)) {
+                Serial.printf("MidiPlayer Error: Invalid event %lu (type byte 0x%02x).\n",
+                              (unsigned long)i, pending_event[2]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (current_event_count > data_size / BYTES_PER_EVENT) {
+        Serial.printf("MidiPlayer Error: Event count %lu exceeds the %lu byte data array.\n",
+                      (unsigned long)current_event_count, (unsigned long)data_size);
+        return false;
+    }
+    for (uint32_t i = 0; i < current_event_count; ++i) {
+        // Reads the data directly: PROGMEM is memory mapped on the ESP32
+        if (!songEventValid(current_song_data_ptr, i)) {
+            Serial.printf("MidiPlayer Error: Invalid event %lu (type byte 0x%02x).\n",
+                          (unsigned long)i, songEventByte(current_song_data_ptr, i, 2));
+            return false;
+        }
+    }
+    return true;
+}
+
+// Copy the next playable event into pending_event, following repeat instructions.
+// Events are always fetched in order, which is what the LZ decoder needs.
+// Returns false when the song has no events left.
+bool MidiPlayer::fetchEvent() {
+    while (true) {
+        // Loop or leave repeat ranges that just finished
+        while (repeat_depth > 0 && current_event_index == repeat_stack[repeat_depth - 1].end) {
+            RepeatFrame& frame = repeat_stack[repeat_depth - 1];
+            if (--frame.remaining > 0) {
+                current_event_index = frame.start;
+            } else {
+                current_event_index = frame.return_index;
+                repeat_depth--;
+            }
+        }
+        if (current_event_index >= current_event_count) return false;
+
+        if (current_song_format == SONG_FORMAT_LZ) {
+            lz_decoder.read(pending_event, BYTES_PER_EVENT);
+            return true; // Repeat instructions are not supported in compressed streams
+        }
+        memcpy_P(pending_event, current_song_data_ptr + (current_event_index * BYTES_PER_EVENT), BYTES_PER_EVENT);
+        if ((pending_event[2] & EVENT_TYPE_MASK) != EVENT_TYPE_REPEAT) return true;
+        enterRepeat();
+    }
+}
+
+// pending_event holds a repeat instruction at current_event_index: jump into its range
+void MidiPlayer::enterRepeat() {
+    uint16_t length = read_uint16_big_endian(pending_event);       // Offset 0
+    uint16_t distance = read_uint16_big_endian(pending_event + 3); // Offset 3
+    uint8_t count = pending_event[5];                              // Offset 5
+
+    if (length == 0 || count == 0 || distance < length || distance > current_event_index ||
+        repeat_depth >= MAX_REPEAT_DEPTH) {
+        // Malformed or too deeply nested: skip the instruction
+        current_event_index++;
+        return;
+    }
+
+    RepeatFrame& frame = repeat_stack[repeat_depth++];
+    frame.start = current_event_index - distance;
+    frame.end = frame.start + length;
+    frame.return_index = current_event_index + 1;
+    frame.remaining = count;
+    current_event_index = frame.start;
 }
 
 void MidiPlayer::processCurrentEvent() {
+    if ((pending_event[2] & EVENT_TYPE_MASK) == EVENT_TYPE_TEMPO) {
+        // Applies from this tick on, so the next delta is already converted with it
+        applyTempoEvent(pending_event);
+        return;
+    }
     if (!synth) return; // Need synth to process
 
-    const uint8_t* current_event_address = current_song_data_ptr + (current_event_index * BYTES_PER_EVENT);
+    // Event data was already fetched from FLASH when it was scheduled
+    uint8_t type_byte = pending_event[2];   // Offset 2
+    uint8_t note_number = pending_event[3]; // Offset 3
+    uint8_t velocity = pending_event[4];    // Offset 4
+    uint8_t channel = pending_event[5];     // Offset 5
 
-    // Read event data from FLASH
-    uint8_t event_type = pgm_read_byte_near(current_event_address + 2); // Offset 2
-    uint8_t note_number = pgm_read_byte_near(current_event_address + 3); // Offset 3
-    uint8_t velocity = pgm_read_byte_near(current_event_address + 4);    // Offset 4
+    uint8_t event_type = type_byte & EVENT_TYPE_MASK;
+    int voice_index = (int)(type_byte >> EVENT_VOICE_SHIFT) - 1; // -1 = not pre-allocated
 
     // Debug print
     // Serial.printf("MidiPlayer T:%lu E:%u Typ:%u N:%u V:%u\n",
     //              millis(), current_event_index, event_type, note_number, velocity);
 
     // Execute the event
-    if (event_type == 1) { // Note On
-        if (velocity > 0) synth->startNote(note_number, velocity);
+    // EVENT_TYPE_LONG_DELTA only carries time and falls through as a no-op
+    if (event_type == EVENT_TYPE_CONTROL) {
+        // Controller number and value sit where a note event has its note and velocity
+        if (note_number == SONG_MIDI_CC_PAN) synth->setChannelPan(channel, velocity);
+    } else if (voice_index >= 0 && voice_index < SYNTH_MAX_VOICES) {
+        // Fast path: voice was assigned by the converter, no searching
+        if (event_type == EVENT_TYPE_NOTE_ON && velocity > 0) synth->startNoteOnVoice(voice_index, note_number, velocity, channel);
+        else if (event_type <= EVENT_TYPE_NOTE_ON) synth->stopNoteOnVoice(voice_index, note_number);
+    } else if (event_type == EVENT_TYPE_NOTE_ON) {
+        if (velocity > 0) synth->startNote(note_number, velocity, channel);
         else synth->stopNote(note_number); // Note On w/ vel 0 == Note Off
-    } else if (event_type == 0) { // Note Off
+    } else if (event_type == EVENT_TYPE_NOTE_OFF) {
         synth->stopNote(note_number);
     }
 }
 
-void MidiPlayer::scheduleNextEvent(unsigned long current_processing_time_ms) {
-     if (current_event_index < current_event_count) {
-        const uint8_t* next_event_address = current_song_data_ptr + (current_event_index * BYTES_PER_EVENT);
-        uint16_t next_delta_ticks = pgm_read_uint16_big_endian(next_event_address); // Offset 0
+void MidiPlayer::scheduleNextEvent(unsigned long event_time_ms) {
+     if (fetchEvent()) {
+        uint32_t next_delta_ticks = readEventDeltaTicks(pending_event);
         unsigned long next_delta_ms = convertTicksToMillis(next_delta_ticks);
 
-        // Schedule relative to when the current event was processed
-        next_event_time_ms = current_processing_time_ms + next_delta_ms;
+        // Schedule relative to the current event's ideal time
+        next_event_time_ms = event_time_ms + next_delta_ms;
 
          // Debug print
         // Serial.printf("  Next event %u scheduled in %lu ms (ticks: %u) at %lu\n",
@@ -3,7 +3,9 @@
 
 #include <Arduino.h>
 #include "Synthesizer.h" // Needs access to the Synthesizer class
-#include "SongData.h"    // Needs access to SongInfo struct definition
+#include "SongFormat.h"  // Event layout and SongInfo struct definition
+#include "LzStreamDecoder.h" // For compressed songs
+#include "LatencyHistogram.h"
 
 // Class to handle MIDI playback logic
 class MidiPlayer {
@@ -19,6 +21,10 @@ public:
     // Start playback of the loaded song
     void start();
 
+    // Start with song time counting from start_time_ms instead of millis()
+    // (offline rendering drives the clock itself, see SongRenderer.h)
+    void startAt(unsigned long start_time_ms);
+
     // Stop playback (optional, might not be needed if just playing once)
     void stop();
 
@@ -26,33 +32,82 @@ public:
     // Returns true if playing, false if finished or stopped.
     bool update();
 
+    // Process the next event now, as if its scheduled time had come, and schedule
+    // the one after it. For offline rendering and benchmarks; no millis() involved.
+    // Returns false once the song is finished.
+    bool step();
+
+    // Latency of every event dispatched by update(), in microseconds:
+    // dispatch = how late update() ran it compared to its ideal song time,
+    // audible  = dispatch plus the synth's estimated time to reach the DAC.
+    // Query from the task that calls update().
+    const LatencyHistogram& dispatchLatency() const { return dispatch_latency; }
+    const LatencyHistogram& audibleLatency() const { return audible_latency; }
+    void resetLatencyStats();
+
+    bool isPlaying() const { return is_playing; }
+    // Song time at which the next event is due (same clock as start/startAt)
+    unsigned long nextEventTime() const { return next_event_time_ms; }
+
 private:
     // --- Constants ---
-    static const uint8_t BYTES_PER_EVENT = 6;
+    static const uint8_t BYTES_PER_EVENT = SONG_BYTES_PER_EVENT;
     static const uint16_t TICKS_PER_QUARTER_NOTE = 96;
+    // Event layout, see SongFormat.h
+    static const uint8_t EVENT_TYPE_MASK = SONG_EVENT_TYPE_MASK;
+    static const uint8_t EVENT_VOICE_SHIFT = SONG_EVENT_VOICE_SHIFT;
+    static const uint8_t EVENT_TYPE_NOTE_OFF = SONG_EVENT_NOTE_OFF;
+    static const uint8_t EVENT_TYPE_NOTE_ON = SONG_EVENT_NOTE_ON;
+    static const uint8_t EVENT_TYPE_LONG_DELTA = SONG_EVENT_LONG_DELTA;
+    static const uint8_t EVENT_TYPE_REPEAT = SONG_EVENT_REPEAT;
+    static const uint8_t EVENT_TYPE_TEMPO = SONG_EVENT_TEMPO;
+    static const uint8_t EVENT_TYPE_CONTROL = SONG_EVENT_CONTROL;
+    static const uint8_t MAX_REPEAT_DEPTH = 4;
+    // Longest wait we schedule in one go; keeps wrap-safe millis() comparisons valid
+    static const unsigned long MAX_DELTA_MS = 0x7FFFFFFFUL;
 
     // --- References ---
     Synthesizer* synth; // Pointer to the synth engine
 
     // --- Loaded Song Info ---
     const uint8_t* current_song_data_ptr; // Pointer to selected song's data in PROGMEM
-    uint16_t current_event_count;
+    uint32_t current_event_count;
     float current_bpm;
+    uint8_t current_song_format;          // SONG_FORMAT_RAW or SONG_FORMAT_LZ
+
+    // --- Repeat Call Stack ---
+    struct RepeatFrame {
+        uint32_t start;        // First event of the repeated range
+        uint32_t end;          // One past the last event of the range
+        uint32_t return_index; // Event after the repeat instruction
+        uint8_t remaining;     // Passes left, including the current one
+    };
 
     // --- Playback State ---
     bool is_playing;
-    uint16_t current_event_index;
+    uint32_t current_event_index;
     unsigned long next_event_time_ms;
+    uint8_t pending_event[BYTES_PER_EVENT]; // Event at current_event_index, fetched when scheduled
+    LzStreamDecoder lz_decoder;             // Only used for SONG_FORMAT_LZ songs
+    RepeatFrame repeat_stack[MAX_REPEAT_DEPTH];
+    uint8_t repeat_depth;
 
     // --- Timing ---
     float millis_per_tick;
+    LatencyHistogram dispatch_latency;
+    LatencyHistogram audible_latency;
 
     // --- Private Helper Methods ---
     void calculateTimingFactors(float bpm);
-    unsigned long convertTicksToMillis(uint16_t ticks);
-    uint16_t pgm_read_uint16_big_endian(const uint8_t* flash_address);
+    void applyTempoEvent(const uint8_t* event);
+    unsigned long convertTicksToMillis(uint32_t ticks);
+    uint16_t read_uint16_big_endian(const uint8_t* address);
+    uint32_t readEventDeltaTicks(const uint8_t* event);
+    bool validateSong(uint32_t data_size);
+    bool fetchEvent();
+    void enterRepeat();
     void processCurrentEvent();
-    void scheduleNextEvent(unsigned long current_processing_time_ms);
+    void scheduleNextEvent(unsigned long event_time_ms);
 };
 
 #endif // MIDI_PLAYER_H
\ No newline at end of file
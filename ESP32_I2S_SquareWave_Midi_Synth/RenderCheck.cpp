@@ -0,0 +1,316 @@
+#include "RenderCheck.h"
+#include "SongRenderer.h"
+#include "JsonPrint.h"
+#include <pgmspace.h> // For PROGMEM read functions
+#include <cmath>      // For sqrt
+
+// --- Golden Renders ---
+// Re-record after an intended change to the sound: run the check and copy the
+// hashes and the RENDER_RMS levels it prints. Songs are matched by title, so the
+// bank can be reordered.
+struct GoldenRender {
+    const char* title;
+    uint32_t samples;
+    uint32_t hash;
+    const uint16_t* rms; // RMS level of every whole second, to show where a failing render differs
+    uint16_t rms_seconds;
+};
+
+static const uint16_t TWINKLE_RMS[] = {
+    2829, 5002, 3887, 3065, 1960, 3262, 4870, 1573, 3253, 4445, 5415, 5245, 6777, 7792,
+    7547, 5489, 4083, 4816, 5269, 5810, 8427, 7107, 6154, 5222, 3604, 5559, 5395, 4366,
+    5050, 5144, 4754, 5057, 3145, 3701, 5333, 6088, 5279, 7029, 7652, 6709, 5283, 3247,
+    5343, 6810, 6546, 6106, 7228, 6570, 7389, 6895, 5724, 5604, 6819, 6509, 6590, 7883,
+    6112, 7341, 6523,
+};
+static const uint16_t LA_BAMBA_RMS[] = {
+    2634, 11445, 6135, 6371, 5859, 6229, 6336, 4135, 8259, 6358, 5624, 5631, 5590, 5683,
+    5699, 5718, 4779, 5016, 5868, 5769, 5370, 6035, 4997, 4697, 4429, 4740, 4794, 4423,
+    4481, 4686, 4914, 4343, 4726, 4772, 7199, 6736, 6643,
+};
+static const uint16_t STROBE_SIMPLE_RMS[] = {
+    9927, 9006, 9079, 9136, 9016, 9088, 8977, 10087, 9774, 8936, 8986, 8975, 8981, 8992,
+    8985, 10790, 9003, 9101, 9139, 9120, 9085, 9078, 10230, 9676, 8928, 9011, 8966, 8977,
+    8985,
+};
+static const uint16_t STROBE_REFINED_RMS[] = {
+    5947, 5827, 6131, 6039, 6294, 6650, 6869, 6670, 7254, 7515, 7869, 7675, 7647, 8147,
+    8407, 6373, 7080, 8629, 7055, 6232, 7679, 8252, 6951, 6853, 8509, 8493, 7063, 7423,
+    8122, 8011, 6181, 6224, 6751, 6238, 5993, 6517, 6885, 6681, 6291, 6804, 6692, 6010,
+    6076, 6804,
+};
+static const uint16_t TETRIS_A_RMS[] = {
+    4763, 5046, 4714, 4710, 4653, 4548, 5196, 4989, 4836, 4917, 4754, 4939, 4685, 5510,
+    5045, 4068, 4123, 4486, 4074, 4092, 4353, 4287, 4036, 4114, 4515, 4028, 4009, 4049,
+};
+
+#define GOLDEN_RMS(table) table, (uint16_t)(sizeof(table) / sizeof(table[0]))
+
+static const GoldenRender GOLDEN_RENDERS[] = {
+    { "Twinkle Twinkle", 2618791UL, 0xaf5b875aUL, GOLDEN_RMS(TWINKLE_RMS) },
+    { "La Bamba", 1675668UL, 0x2eb6ff78UL, GOLDEN_RMS(LA_BAMBA_RMS) },
+    { "Strobe Simple", 1320884UL, 0x94ca42d1UL, GOLDEN_RMS(STROBE_SIMPLE_RMS) },
+    { "Strobe Refined", 1975945UL, 0x36f8f375UL, GOLDEN_RMS(STROBE_REFINED_RMS) },
+    { "Tetris A 1st Half", 1254249UL, 0x6219ace9UL, GOLDEN_RMS(TETRIS_A_RMS) },
+};
+
+// Panning check: four 500 ms sections at 120 BPM (96 ticks each).
+// 1. channel 0 hard left, 2. channel 1 hard right, 3. channel 2 at the default center,
+// 4. channels 0 and 1 together, channel 0 moving to CC10 32 halfway through its note.
+// Event type high nibble = pre-allocated voice + 1, see SongFormat.h.
+constexpr uint8_t PAN_TEST_DATA[] PROGMEM = {
+    0, 0,  SONG_EVENT_CONTROL, SONG_MIDI_CC_PAN, 0, 0,
+    0, 0,  0x10 | SONG_EVENT_NOTE_ON, 60, 100, 0,
+    0, 96, 0x10 | SONG_EVENT_NOTE_OFF, 60, 0, 0,
+    0, 0,  SONG_EVENT_CONTROL, SONG_MIDI_CC_PAN, 127, 1,
+    0, 0,  0x20 | SONG_EVENT_NOTE_ON, 64, 100, 1,
+    0, 96, 0x20 | SONG_EVENT_NOTE_OFF, 64, 0, 1,
+    0, 0,  0x30 | SONG_EVENT_NOTE_ON, 67, 100, 2,
+    0, 96, 0x30 | SONG_EVENT_NOTE_OFF, 67, 0, 2,
+    0, 0,  0x10 | SONG_EVENT_NOTE_ON, 60, 100, 0,
+    0, 0,  0x20 | SONG_EVENT_NOTE_ON, 64, 100, 1,
+    0, 48, SONG_EVENT_CONTROL, SONG_MIDI_CC_PAN, 32, 0,
+    0, 48, 0x10 | SONG_EVENT_NOTE_OFF, 60, 0, 0,
+    0, 0,  0x20 | SONG_EVENT_NOTE_OFF, 64, 0, 1,
+};
+SONG_VALIDATE(PAN_TEST_DATA);
+static const uint32_t PAN_TEST_SECTION_MS = 500;
+static const uint32_t PAN_TEST_SECTIONS = 4;
+static const SongInfo PAN_TEST_SONG PROGMEM = {
+    PAN_TEST_DATA, SONG_EVENT_COUNT(PAN_TEST_DATA), 120.0f, SONG_FORMAT_RAW, "Pan Test",
+    PAN_TEST_SECTION_MS * PAN_TEST_SECTIONS, sizeof(PAN_TEST_DATA)
+};
+static const GoldenRender PAN_GOLDEN = { "Pan Test", 88200UL, 0xcf368422UL, nullptr, 0 }; // Stereo frames
+
+static const uint32_t FNV_PRIME = 16777619UL;
+
+struct RenderState {
+    uint32_t hash;
+    // Per-second RMS, of every whole second of song time (SYNTH_SAMPLE_RATE samples)
+    uint16_t* rms;
+    uint32_t rms_capacity;
+    uint32_t second;
+    uint32_t second_samples;
+    double second_sum_squares;
+};
+
+uint32_t hashRenderedSamples(uint32_t hash, const int16_t* samples, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        uint16_t s = (uint16_t)samples[i];
+        hash = (hash ^ (s & 0xFF)) * FNV_PRIME; // Little-endian bytes, as in a WAV file
+        hash = (hash ^ (s >> 8)) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static void renderSink(const int16_t* samples, size_t count, void* context) {
+    RenderState* state = static_cast<RenderState*>(context);
+    state->hash = hashRenderedSamples(state->hash, samples, count);
+    for (size_t i = 0; i < count; ++i) {
+        state->second_sum_squares += (double)samples[i] * samples[i];
+        if (++state->second_samples == (uint32_t)SYNTH_SAMPLE_RATE) {
+            if (state->second < state->rms_capacity) {
+                state->rms[state->second] = (uint16_t)sqrt(state->second_sum_squares / SYNTH_SAMPLE_RATE);
+            }
+            state->second++;
+            state->second_samples = 0;
+            state->second_sum_squares = 0.0;
+        }
+    }
+}
+
+static void dumpSink(const int16_t* samples, size_t count, void* context) {
+    const RenderDump* dump = static_cast<const RenderDump*>(context);
+    dump->write(samples, count, dump->context);
+}
+
+// RENDER_RMS line: the level of every second, and for a failing song the new level
+// minus the golden one per second (a missing second counts as 0) and the first
+// second that differs, -1 if the levels all match
+static void printRms(const char* title, const RenderState& state, const GoldenRender* golden) {
+    uint32_t seconds = state.second < state.rms_capacity ? state.second : state.rms_capacity;
+    Serial.print("RENDER_RMS {\"title\":");
+    printJsonString(title);
+    Serial.print(",\"rms\":[");
+    for (uint32_t i = 0; i < seconds; ++i) {
+        Serial.printf(i ? ",%u" : "%u", state.rms[i]);
+    }
+    Serial.print("]");
+    if (golden && golden->rms) {
+        uint32_t delta_seconds = seconds > golden->rms_seconds ? seconds : golden->rms_seconds;
+        long first_change = -1;
+        Serial.print(",\"rms_delta\":[");
+        for (uint32_t i = 0; i < delta_seconds; ++i) {
+            long delta = (long)(i < seconds ? state.rms[i] : 0) - (long)(i < golden->rms_seconds ? golden->rms[i] : 0);
+            if (delta != 0 && first_change < 0) first_change = (long)i;
+            Serial.printf(i ? ",%ld" : "%ld", delta);
+        }
+        Serial.printf("],\"first_changed_second\":%ld", first_change);
+    }
+    Serial.println("}");
+}
+
+static const GoldenRender* findGolden(const char* title) {
+    for (size_t i = 0; i < sizeof(GOLDEN_RENDERS) / sizeof(GOLDEN_RENDERS[0]); ++i) {
+        if (title && strcmp(GOLDEN_RENDERS[i].title, title) == 0 && GOLDEN_RENDERS[i].samples != 0) {
+            return &GOLDEN_RENDERS[i];
+        }
+    }
+    return nullptr;
+}
+
+// Renders one song; returns false if it does not match its golden hash
+static bool checkSong(Synthesizer& synth, MidiPlayer& player, const SongInfo* song, float output_rate,
+                      const RenderDump* dump) {
+    const char* title = (const char*)pgm_read_ptr_near(&song->title);
+    uint32_t duration_ms = pgm_read_dword_near(&song->duration_ms);
+
+    RenderState state = { RENDER_HASH_BASIS, nullptr, duration_ms / 1000 + 2, 0, 0, 0.0 };
+    state.rms = (uint16_t*)malloc(state.rms_capacity * sizeof(uint16_t));
+    if (state.rms == nullptr) state.rms_capacity = 0; // Still hashed, just without levels
+    synth.initVoices();
+    if (!player.loadSong(song)) {
+        free(state.rms);
+        return false;
+    }
+    unsigned long start_us = micros();
+    uint32_t samples = SongRenderer::render(synth, player, renderSink, &state);
+    unsigned long elapsed_us = micros() - start_us;
+
+    const GoldenRender* golden = findGolden(title);
+    const char* result = "new";
+    if (golden) {
+        result = (golden->samples == samples && golden->hash == state.hash) ? "pass" : "fail";
+    }
+    float realtime_factor = elapsed_us ? (samples * 1e6f / output_rate) / elapsed_us : 0.0f;
+
+    Serial.print("RENDER {\"title\":");
+    printJsonString(title);
+    Serial.printf(",\"samples\":%lu,\"hash\":\"0x%08lx\",\"result\":\"%s\",\"realtime_factor\":%.1f",
+                  (unsigned long)samples, (unsigned long)state.hash, result, realtime_factor);
+    if (golden) {
+        Serial.printf(",\"golden_samples\":%lu,\"golden_hash\":\"0x%08lx\"",
+                      (unsigned long)golden->samples, (unsigned long)golden->hash);
+    }
+    Serial.println("}");
+
+    bool passed = strcmp(result, "pass") == 0;
+    if (!passed) printRms(title, state, golden); // New songs too, to record their levels
+    free(state.rms);
+    if (!golden || passed) {
+        return true;
+    }
+
+    // Failed: render again into the dump
+    if (dump && dump->open(title, (uint32_t)lroundf(synth.sampleRate()), 1, dump->context)) {
+        synth.initVoices();
+        player.loadSong(song);
+        SongRenderer::render(synth, player, dumpSink, (void*)dump);
+        dump->close(dump->context);
+    }
+    return false;
+}
+
+// Pack a ramp with the audio task's packFrames() and read the words back in the
+// order the I2S peripheral shifts out half-words (upper half first): the slots must
+// carry the rendered samples in order (frame n, and left before right in stereo),
+// so a format change cannot reorder, swap or drop samples.
+static bool checkFrameLayout() {
+    const int sample_count = SYNTH_RENDER_BLOCK_SAMPLES * SYNTH_OUTPUT_CHANNELS;
+    int16_t samples[sample_count];
+    uint32_t words[sample_count / 2];
+    for (int i = 0; i < sample_count; ++i) {
+        samples[i] = (int16_t)(i * 509 - 32000); // Distinct values, both signs
+    }
+    size_t word_count = Synthesizer::packFrames(samples, sample_count, words);
+
+    bool ok = word_count * 2 == (size_t)sample_count;
+    for (size_t slot = 0; ok && slot < word_count * 2; ++slot) {
+        uint32_t word = words[slot / 2];
+        int16_t value = (int16_t)(slot % 2 == 0 ? word >> 16 : word & 0xFFFF);
+        ok = value == samples[slot];
+    }
+    Serial.printf("FRAMES {\"channels\":%d,\"bytes_per_block\":%u,\"result\":\"%s\"}\n",
+                  SYNTH_OUTPUT_CHANNELS, (unsigned)(word_count * sizeof(words[0])), ok ? "pass" : "fail");
+    return ok;
+}
+
+struct PanState {
+    uint32_t hash;
+    uint32_t frame;
+    uint32_t section_end[PAN_TEST_SECTIONS]; // First frame of the next section
+    uint64_t level[PAN_TEST_SECTIONS][2];    // Sum of |sample| per channel
+    uint32_t unbalanced_frames;              // Section 3 frames with left != right
+};
+
+static void panSink(const int16_t* samples, size_t count, void* context) {
+    PanState* state = static_cast<PanState*>(context);
+    for (size_t i = 0; i + 1 < count; i += 2, state->frame++) {
+        uint32_t section = 0;
+        while (section + 1 < PAN_TEST_SECTIONS && state->frame >= state->section_end[section]) section++;
+        state->level[section][0] += abs(samples[i]);
+        state->level[section][1] += abs(samples[i + 1]);
+        if (section == 2 && samples[i] != samples[i + 1]) state->unbalanced_frames++;
+    }
+    state->hash = hashRenderedSamples(state->hash, samples, count);
+}
+
+// Render PAN_TEST_DATA in stereo: a hard-panned channel must be exactly silent on
+// the other side, a centered one identical on both, and the whole render must match
+// its golden hash (which pins the pan law table and the stereo mix).
+static bool checkPanning(Synthesizer& synth, MidiPlayer& player, const RenderDump* dump) {
+    PanState state = {};
+    state.hash = RENDER_HASH_BASIS;
+    uint32_t sample_rate = (uint32_t)lroundf(synth.sampleRate());
+    for (uint32_t s = 0; s < PAN_TEST_SECTIONS; ++s) {
+        state.section_end[s] = ((uint64_t)PAN_TEST_SECTION_MS * (s + 1) * sample_rate + 999) / 1000;
+    }
+    synth.initVoices();
+    if (!player.loadSong(&PAN_TEST_SONG)) {
+        return false;
+    }
+    uint32_t frames = SongRenderer::render(synth, player, panSink, &state, 2);
+
+    bool left_only = state.level[0][0] > 0 && state.level[0][1] == 0;
+    bool right_only = state.level[1][0] == 0 && state.level[1][1] > 0;
+    bool center = state.level[2][0] > 0 && state.unbalanced_frames == 0;
+    const char* result = "new";
+    if (PAN_GOLDEN.samples != 0) {
+        result = (PAN_GOLDEN.samples == frames && PAN_GOLDEN.hash == state.hash) ? "pass" : "fail";
+    }
+    bool ok = left_only && right_only && center && strcmp(result, "fail") != 0;
+    Serial.printf("PAN {\"frames\":%lu,\"hash\":\"0x%08lx\",\"left_only\":%s,\"right_only\":%s,\"center\":%s,"
+                  "\"result\":\"%s\",\"golden_frames\":%lu,\"golden_hash\":\"0x%08lx\"}\n",
+                  (unsigned long)frames, (unsigned long)state.hash, left_only ? "true" : "false",
+                  right_only ? "true" : "false", center ? "true" : "false", ok ? result : "fail",
+                  (unsigned long)PAN_GOLDEN.samples, (unsigned long)PAN_GOLDEN.hash);
+    if (!ok && dump && dump->open(PAN_GOLDEN.title, sample_rate, 2, dump->context)) {
+        synth.initVoices();
+        player.loadSong(&PAN_TEST_SONG);
+        SongRenderer::render(synth, player, dumpSink, (void*)dump, 2);
+        dump->close(dump->context);
+    }
+    return ok;
+}
+
+bool runRenderCheck(const SongInfo* songs, uint16_t song_count, float output_rate, const RenderDump* dump) {
+    static Synthesizer synth; // Offline: no I2S, no audio task
+    static MidiPlayer player;
+    if (!synth.initVoices()) {
+        Serial.println("Render Check Error: Failed to set up the offline synthesizer.");
+        return false;
+    }
+    player.init(synth);
+    if (output_rate <= 0.0f) output_rate = SYNTH_SAMPLE_RATE;
+    bool frames_ok = checkFrameLayout();
+    bool pan_ok = checkPanning(synth, player, dump);
+
+    uint16_t failed = 0;
+    for (uint16_t i = 0; i < song_count; ++i) {
+        if (!checkSong(synth, player, &songs[i], output_rate, dump)) {
+            failed++;
+        }
+    }
+    Serial.printf("Render check: %u of %u songs failed.\n", failed, song_count);
+    return failed == 0 && frames_ok && pan_ok;
+}
@@ -0,0 +1,45 @@
+#ifndef RENDER_CHECK_H
+#define RENDER_CHECK_H
+
+#include <Arduino.h>
+#include "SongFormat.h"
+#include "SongRenderer.h"
+
+// Somewhere to put a failing render, e.g. a WAV file on the host. open() is called
+// with the title before the render (return false to skip it), write() with each
+// block and close() after it; context is passed to all three.
+struct RenderDump {
+    bool (*open)(const char* title, uint32_t sample_rate, int channels, void* context);
+    SongRenderer::SampleSink write;
+    void (*close)(void* context);
+    void* context;
+};
+
+// Golden-render regression check.
+//
+// Renders every song offline (SongRenderer), hashes the PCM output (FNV-1a over
+// the 16-bit samples) and compares it with the hashes recorded in RenderCheck.cpp.
+// Prints one JSON line per song, prefixed with "RENDER ". A failing song gets a
+// second "RENDER_RMS " line with the RMS level of every second of the new render,
+// its difference from the recorded level of that second (new minus golden) and
+// the first second that differs, to find where the output changed. Songs without
+// a recorded hash are reported as "new" with their hash and RENDER_RMS levels,
+// ready to be added to the table.
+// First a "FRAMES " line checks the I2S frame layout (stereo or SYNTH_MONO_OUTPUT)
+// the audio task sends for a rendered block, then a "PAN " line renders a short
+// built-in song in stereo and checks channel separation, the center balance and
+// its golden hash.
+// Songs are rendered at SYNTH_SAMPLE_RATE, the rate of the golden hashes, and the
+// RMS windows are seconds of song time at that rate.
+// output_rate is the rate the DAC actually runs at (Synthesizer::sampleRate() after
+// init()): the real-time factor is measured against it.
+// dump, if given, receives the new render of every song (and pan test) that fails.
+// Returns true if no song failed and the frame layout and panning are correct.
+bool runRenderCheck(const SongInfo* songs, uint16_t song_count, float output_rate, const RenderDump* dump = nullptr);
+
+// The recorded hash: FNV-1a over the samples' little-endian bytes, as in a WAV file.
+// Start from RENDER_HASH_BASIS and pass each block of a render in turn.
+const uint32_t RENDER_HASH_BASIS = 2166136261UL;
+uint32_t hashRenderedSamples(uint32_t hash, const int16_t* samples, size_t count);
+
+#endif // RENDER_CHECK_H
@@ -3,87 +3,107 @@
 
 #include <Arduino.h>
 #include <pgmspace.h>  // For PROGMEM
+#include "SongFormat.h" // SongInfo, SONG_EVENT_COUNT and SONG_VALIDATE
+
+// Set to 1 to play the bank generated by
+//   python myMidiParse2.py --bank <midi dir> -o SongBank.h
+// instead of the songs defined below. Add --bin for large libraries: the song
+// bytes go to songs/*.bin and are linked by the generated SongBank.S instead of
+// being compiled as hex arrays. Its .incbin paths are relative to the sketch
+// folder, so the assembler needs it on the include path (-I<sketch folder>, e.g.
+// in compiler.S.extra_flags).
+#define USE_SONG_BANK 0
+
+#if USE_SONG_BANK
+#include "SongBank.h"
+#else
 
 //=============================================================================
 // USER AREA: DEFINE SONGS HERE
 //=============================================================================
 
 // --- Instructions ---
-// 1. For each song, define SONGx_DATA, EVENT_COUNT_x, and BPM_x.
-// 2. Paste your generated byte array into the SONGx_DATA definition.
-// 3. Set EVENT_COUNT_x and BPM_x accurately for that song.
-// 4. Add an entry { SONGx_DATA, EVENT_COUNT_x, BPM_x } to the song_list array below.
-// 5. IMPORTANT: Update the SONG_COUNT constant below to match the total number of songs in song_list.
+// 1. For each song, define SONGx_DATA and BPM_x.
+// 2. Paste your generated byte array into the constexpr SONGx_DATA definition
+//    (or generate a complete song header with myMidiParse2.py --header).
+// 3. Derive EVENT_COUNT_x with SONG_EVENT_COUNT(SONGx_DATA) and add SONG_VALIDATE(SONGx_DATA);
+//    malformed data then fails to compile instead of running off the end of flash.
+// 4. Add an entry { SONGx_DATA, EVENT_COUNT_x, BPM_x, SONG_FORMAT_x, "Title", duration_ms, sizeof(SONGx_DATA) }
+//    to the song_list array below
+//    (SONG_FORMAT_LZ if the array was generated with --compress, otherwise SONG_FORMAT_RAW;
+//    compressed songs need their event count from the converter and cannot use SONG_VALIDATE;
+//    MidiPlayer checks them against sizeof(SONGx_DATA) when the song is loaded).
+// SONG_COUNT is derived from song_list.
 
 
-// --- Master Song Count ---
-const uint16_t SONG_COUNT = 5;  // !! UPDATE THIS COUNT !!
-
 // --- Song 1 Definition --- Twinkle Twinkle
-const uint16_t EVENT_COUNT_1 = 968;  // !! SET EVENT COUNT FOR SONG 1 !!
 const float BPM_1 = 96.0f;          // !! SET BPM FOR SONG 1 !!
-const uint8_t SONG1_DATA[] PROGMEM = {
+constexpr uint8_t SONG1_DATA[] PROGMEM = {
   
   0x00, 0x00, 0x01, 0x3b, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x1e, 0x00, 0x00, 0x02, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x07, 0x01, 0x48, 0x37, 0x00, 0x00, 0x05, 0x01, 0x30, 0x2f, 0x00, 0x00, 0x0a, 0x00, 0x48, 0x40, 0x00, 0x00, 0x02, 0x00, 0x30, 0x40, 0x00, 0x00, 0x35, 0x01, 0x3c, 0x30, 0x00, 0x00, 0x00, 0x01, 0x48, 0x44, 0x00, 0x00, 0x0e, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x02, 0x00, 0x48, 0x40, 0x00, 0x00, 0x31, 0x01, 0x4f, 0x5a, 0x00, 0x00, 0x00, 0x01, 0x40, 0x47, 0x00, 0x00, 0x13, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x2f, 0x01, 0x4f, 0x5f, 0x00, 0x00, 0x03, 0x01, 0x3c, 0x47, 0x00, 0x00, 0x0b, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x05, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x30, 0x01, 0x51, 0x55, 0x00, 0x00, 0x03, 0x01, 0x41, 0x3b, 0x00, 0x00, 0x10, 0x00, 0x41, 0x40, 0x00, 0x00, 0x02, 0x00, 0x51, 0x40, 0x00, 0x00, 0x30, 0x01, 0x51, 0x48, 0x00, 0x00, 0x03, 0x01, 0x3c, 0x2d, 0x00, 0x00, 0x0c, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x07, 0x00, 0x51, 0x40, 0x00, 0x00, 0x2c, 0x01, 0x4f, 0x45, 0x00, 0x00, 0x06, 0x01, 0x40, 0x2e, 0x00, 0x00, 0x0b, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x02, 0x00, 0x40, 0x40, 0x00, 0x00, 0x31, 0x01, 0x4f, 0x3a, 0x00, 0x00, 0x07, 0x01, 0x3c, 0x22, 0x00, 0x00, 0x08, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x06, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x2f, 0x01, 0x4d, 0x40, 0x00, 0x00, 0x03, 0x01, 0x3e, 0x39, 0x00, 0x00, 0x0c, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x04, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x33, 0x01, 0x3b, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x4d, 0x35, 0x00, 0x00, 0x0b, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x37, 0x01, 0x4c, 0x2e, 0x00, 0x00, 0x02, 0x01, 0x3c, 0x2d, 0x00, 0x00, 0x0d, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x34, 0x01, 0x4c, 0x2b, 0x00, 0x00, 0x03, 0x01, 0x39, 0x21, 0x00, 0x00, 0x0d, 0x00, 0x39, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x36, 0x01, 0x35, 0x3d, 0x00, 0x00, 0x02, 0x01, 0x4a, 0x1b, 0x00, 0x00, 0x0a, 0x00, 0x35, 0x40, 0x00, 0x00, 0x07, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x12, 0x01, 0x4c, 0x2b, 0x00, 0x00, 0x0a, 0x01, 0x4a, 0x36, 0x00, 0x00, 0x01, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x06, 0x01, 0x48, 0x16, 0x00, 0x00, 0x0b, 0x01, 0x4a, 0x3b, 0x00, 0x00, 0x01, 0x01, 0x37, 0x1f, 0x00, 0x00, 0x03, 0x00, 0x48, 0x40, 0x00, 0x00, 0x10, 0x00, 0x37, 0x40, 0x00, 0x00, 0x34, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x16, 0x00, 0x00, 0x0e, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x04, 0x01, 0x48, 0x20, 0x00, 0x00, 0x05, 0x01, 0x30, 0x15, 0x00, 0x00, 0x7f, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x00, 0x48, 0x40, 0x00, 0x00, 0x90, 0x01, 0x4a, 0x37, 0x00, 0x00, 0x09, 0x01, 0x30, 0x1a, 0x00, 0x00, 0x05, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x07, 0x01, 0x48, 0x2b, 0x00, 0x00, 0x0c, 0x00, 0x48, 0x40, 0x00, 0x00, 0x05, 0x01, 0x47, 0x36, 0x00, 0x00, 0x0d, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x48, 0x34, 0x00, 0x00, 0x11, 0x00, 0x48, 0x40, 0x00, 0x00, 0x05, 0x01, 0x47, 0x2d, 0x00, 0x00, 0x04, 0x00, 0x30, 0x40, 0x00, 0x00, 0x03, 0x01, 0x3c, 0x22, 0x00, 0x00, 0x06, 0x00, 0x47, 0x40, 0x00, 0x00, 0x03, 0x01, 0x48, 0x2d, 0x00, 0x00, 0x0d, 0x00, 0x48, 0x40, 0x00, 0x00, 0x02, 0x01, 0x47, 0x35, 0x00, 0x00, 0x0c, 0x00, 0x47, 0x40, 0x00, 0x00, 0x09, 0x01, 0x48, 0x34, 0x00, 0x00, 0x0c, 0x00, 0x48, 0x40, 0x00, 0x00, 0x06, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x09, 0x01, 0x40, 0x27, 0x00, 0x00, 0x01, 0x01, 0x51, 0x41, 0x00, 0x00, 0x0c, 0x00, 0x51, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4f, 0x4d, 0x00, 0x00, 0x0b, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4e, 0x40, 0x00, 0x00, 0x0d, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4f, 0x52, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4e, 0x38, 0x00, 0x00, 0x01, 0x01, 0x3c, 0x19, 0x00, 0x00, 0x05, 0x00, 0x40, 0x40, 0x00, 0x00, 0x07, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x04, 0x01, 0x4f, 0x48, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4e, 0x3f, 0x00, 0x00, 0x15, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4f, 0x4a, 0x00, 0x00, 0x08, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x05, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x04, 0x01, 0x41, 0x28, 0x00, 0x00, 0x02, 0x01, 0x50, 0x4d, 0x00, 0x00, 0x0e, 0x00, 0x50, 0x40, 0x00, 0x00, 0x05, 0x01, 0x51, 0x54, 0x00, 0x00, 0x10, 0x00, 0x51, 0x40, 0x00, 0x00, 0x05, 0x01, 0x54, 0x50, 0x00, 0x00, 0x10, 0x01, 0x53, 0x67, 0x00, 0x00, 0x00, 0x00, 0x54, 0x40, 0x00, 0x00, 0x10, 0x00, 0x53, 0x40, 0x00, 0x00, 0x03, 0x01, 0x3c, 0x1d, 0x00, 0x00, 0x02, 0x01, 0x56, 0x54, 0x00, 0x00, 0x09, 0x00, 0x41, 0x40, 0x00, 0x00, 0x07, 0x00, 0x56, 0x40, 0x00, 0x00, 0x02, 0x01, 0x54, 0x4c, 0x00, 0x00, 0x12, 0x00, 0x54, 0x40, 0x00, 0x00, 0x01, 0x01, 0x53, 0x61, 0x00, 0x00, 0x0a, 0x00, 0x53, 0x40, 0x00, 0x00, 0x06, 0x01, 0x51, 0x45, 0x00, 0x00, 0x0a, 0x00, 0x51, 0x40, 0x00, 0x00, 0x04, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x08, 0x01, 0x40, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x51, 0x4d, 0x00, 0x00, 0x11, 0x00, 0x51, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4f, 0x45, 0x00, 0x00, 0x0d, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x08, 0x01, 0x58, 0x39, 0x00, 0x00, 0x01, 0x00, 0x40, 0x40, 0x00, 0x00, 0x0d, 0x00, 0x58, 0x40, 0x00, 0x00, 0x09, 0x01, 0x56, 0x39, 0x00, 0x00, 0x0d, 0x00, 0x56, 0x40, 0x00, 0x00, 0x06, 0x01, 0x54, 0x29, 0x00, 0x00, 0x0e, 0x00, 0x54, 0x40, 0x00, 0x00, 0x03, 0x01, 0x53, 0x4c, 0x00, 0x00, 0x0b, 0x00, 0x53, 0x40, 0x00, 0x00, 0x08, 0x01, 0x51, 0x2b, 0x00, 0x00, 0x0e, 0x00, 0x51, 0x40, 0x00, 0x00, 0x04, 0x01, 0x3d, 0x2d, 0x00, 0x00, 0x01, 0x01, 0x4f, 0x39, 0x00, 0x00, 0x0b, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x0b, 0x01, 0x3e, 0x40, 0x00, 0x00, 0x11, 0x01, 0x4d, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x08, 0x01, 0x56, 0x3c, 0x00, 0x00, 0x0a, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x07, 0x00, 0x56, 0x40, 0x00, 0x00, 0x04, 0x01, 0x54, 0x49, 0x00, 0x00, 0x14, 0x01, 0x53, 0x56, 0x00, 0x00, 0x01, 0x00, 0x54, 0x40, 0x00, 0x00, 0x0d, 0x00, 0x53, 0x40, 0x00, 0x00, 0x06, 0x01, 0x51, 0x3c, 0x00, 0x00, 0x0c, 0x00, 0x51, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4f, 0x3f, 0x00, 0x00, 0x0d, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4d, 0x3e, 0x00, 0x00, 0x01, 0x01, 0x3b, 0x32, 0x00, 0x00, 0x0b, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x08, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x11, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4c, 0x3d, 0x00, 0x00, 0x0c, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x07, 0x01, 0x54, 0x4b, 0x00, 0x00, 0x05, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x10, 0x01, 0x53, 0x5c, 0x00, 0x00, 0x01, 0x00, 0x54, 0x40, 0x00, 0x00, 0x11, 0x01, 0x51, 0x45, 0x00, 0x00, 0x02, 0x00, 0x53, 0x40, 0x00, 0x00, 0x10, 0x01, 0x4f, 0x54, 0x00, 0x00, 0x02, 0x00, 0x51, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4d, 0x43, 0x00, 0x00, 0x12, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4c, 0x3f, 0x00, 0x00, 0x05, 0x01, 0x39, 0x28, 0x00, 0x00, 0x0d, 0x00, 0x39, 0x40, 0x00, 0x00, 0x04, 0x01, 0x4a, 0x51, 0x00, 0x00, 0x05, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x02, 0x01, 0x35, 0x4a, 0x00, 0x00, 0x1a, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x08, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x04, 0x00, 0x35, 0x40, 0x00, 0x00, 0x21, 0x01, 0x4f, 0x4a, 0x00, 0x00, 0x02, 0x01, 0x37, 0x39, 0x00, 0x00, 0x00, 0x00, 0x51, 0x40, 0x00, 0x00, 0x0e, 0x00, 0x37, 0x40, 0x00, 0x00, 0x12, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x06, 0x01, 0x47, 0x45, 0x00, 0x00, 0x12, 0x00, 0x47, 0x40, 0x00, 0x00, 0x18, 0x01, 0x48, 0x31, 0x00, 0x00, 0x02, 0x01, 0x3c, 0x31, 0x00, 0x00, 0x24, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x01, 0x37, 0x36, 0x00, 0x00, 0x1b, 0x00, 0x37, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x34, 0x2f, 0x00, 0x00, 0x12, 0x00, 0x48, 0x40, 0x00, 0x00, 0x09, 0x00, 0x34, 0x40, 0x00, 0x00, 0x0f, 0x01, 0x37, 0x26, 0x00, 0x00, 0x1c, 0x00, 0x37, 0x40, 0x00, 0x00, 0x0b, 0x01, 0x30, 0x25, 0x00, 0x00, 0x05, 0x01, 0x4a, 0x1a, 0x00, 0x00, 0x0f, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x02, 0x01, 0x48, 0x31, 0x00, 0x00, 0x0c, 0x00, 0x48, 0x40, 0x00, 0x00, 0x08, 0x01, 0x47, 0x35, 0x00, 0x00, 0x0c, 0x00, 0x47, 0x40, 0x00, 0x00, 0x03, 0x01, 0x48, 0x38, 0x00, 0x00, 0x0b, 0x00, 0x30, 0x40, 0x00, 0x00, 0x07, 0x00, 0x48, 0x40, 0x00, 0x00, 0x06, 0x01, 0x3c, 0x21, 0x00, 0x00, 0x01, 0x01, 0x47, 0x38, 0x00, 0x00, 0x0c, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x48, 0x38, 0x00, 0x00, 0x0f, 0x00, 0x48, 0x40, 0x00, 0x00, 0x05, 0x01, 0x47, 0x38, 0x00, 0x00, 0x0a, 0x00, 0x47, 0x40, 0x00, 0x00, 0x07, 0x01, 0x48, 0x4b, 0x00, 0x00, 0x0b, 0x00, 0x48, 0x40, 0x00, 0x00, 0x03, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x0a, 0x01, 0x51, 0x52, 0x00, 0x00, 0x03, 0x01, 0x40, 0x27, 0x00, 0x00, 0x10, 0x00, 0x51, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4f, 0x4c, 0x00, 0x00, 0x0a, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4e, 0x43, 0x00, 0x00, 0x0b, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4f, 0x4d, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x06, 0x01, 0x3c, 0x27, 0x00, 0x00, 0x05, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4e, 0x41, 0x00, 0x00, 0x0a, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4f, 0x48, 0x00, 0x00, 0x0a, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x31, 0x00, 0x00, 0x10, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4f, 0x3d, 0x00, 0x00, 0x0f, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x00, 0x01, 0x50, 0x4a, 0x00, 0x00, 0x06, 0x01, 0x41, 0x29, 0x00, 0x00, 0x04, 0x00, 0x50, 0x40, 0x00, 0x00, 0x09, 0x01, 0x51, 0x48, 0x00, 0x00, 0x0c, 0x00, 0x51, 0x40, 0x00, 0x00, 0x09, 0x01, 0x54, 0x3d, 0x00, 0x00, 0x0c, 0x00, 0x54, 0x40, 0x00, 0x00, 0x04, 0x01, 0x53, 0x5a, 0x00, 0x00, 0x0c, 0x00, 0x53, 0x40, 0x00, 0x00, 0x08, 0x01, 0x56, 0x51, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x29, 0x00, 0x00, 0x09, 0x00, 0x41, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x56, 0x40, 0x00, 0x00, 0x01, 0x01, 0x54, 0x4e, 0x00, 0x00, 0x0c, 0x00, 0x54, 0x40, 0x00, 0x00, 0x08, 0x01, 0x53, 0x64, 0x00, 0x00, 0x0a, 0x00, 0x53, 0x40, 0x00, 0x00, 0x04, 0x01, 0x51, 0x48, 0x00, 0x00, 0x09, 0x00, 0x51, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x01, 0x51, 0x51, 0x00, 0x00, 0x00, 0x01, 0x40, 0x1e, 0x00, 0x00, 0x14, 0x00, 0x51, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4f, 0x58, 0x00, 0x00, 0x0b, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x01, 0x58, 0x4b, 0x00, 0x00, 0x15, 0x01, 0x56, 0x55, 0x00, 0x00, 0x05, 0x00, 0x58, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x40, 0x40, 0x00, 0x00, 0x05, 0x01, 0x54, 0x44, 0x00, 0x00, 0x04, 0x00, 0x56, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x53, 0x5a, 0x00, 0x00, 0x03, 0x00, 0x54, 0x40, 0x00, 0x00, 0x09, 0x00, 0x53, 0x40, 0x00, 0x00, 0x05, 0x01, 0x51, 0x3d, 0x00, 0x00, 0x0e, 0x00, 0x51, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4f, 0x48, 0x00, 0x00, 0x01, 0x01, 0x3d, 0x26, 0x00, 0x00, 0x0e, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x03, 0x01, 0x3e, 0x57, 0x00, 0x00, 0x14, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4d, 0x49, 0x00, 0x00, 0x0e, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x06, 0x01, 0x56, 0x4a, 0x00, 0x00, 0x06, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x54, 0x58, 0x00, 0x00, 0x04, 0x00, 0x56, 0x40, 0x00, 0x00, 0x10, 0x01, 0x53, 0x60, 0x00, 0x00, 0x06, 0x00, 0x54, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x51, 0x48, 0x00, 0x00, 0x06, 0x00, 0x53, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x51, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4f, 0x47, 0x00, 0x00, 0x14, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x02, 0x01, 0x3b, 0x33, 0x00, 0x00, 0x00, 0x01, 0x4d, 0x42, 0x00, 0x00, 0x0a, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x3c, 0x39, 0x00, 0x00, 0x0b, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4c, 0x33, 0x00, 0x00, 0x0c, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x0a, 0x01, 0x54, 0x3b, 0x00, 0x00, 0x06, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x06, 0x00, 0x54, 0x40, 0x00, 0x00, 0x0a, 0x01, 0x53, 0x42, 0x00, 0x00, 0x0c, 0x00, 0x53, 0x40, 0x00, 0x00, 0x04, 0x01, 0x51, 0x34, 0x00, 0x00, 0x0e, 0x00, 0x51, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4f, 0x44, 0x00, 0x00, 0x0b, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4d, 0x3c, 0x00, 0x00, 0x0c, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4c, 0x38, 0x00, 0x00, 0x04, 0x01, 0x39, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x39, 0x40, 0x00, 0x00, 0x03, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4a, 0x45, 0x00, 0x00, 0x04, 0x01, 0x35, 0x45, 0x00, 0x00, 0x1d, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x08, 0x01, 0x51, 0x38, 0x00, 0x00, 0x26, 0x01, 0x4f, 0x45, 0x00, 0x00, 0x01, 0x00, 0x51, 0x40, 0x00, 0x00, 0x01, 0x01, 0x37, 0x2e, 0x00, 0x00, 0x0f, 0x00, 0x37, 0x40, 0x00, 0x00, 0x0f, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x03, 0x01, 0x47, 0x42, 0x00, 0x00, 0x10, 0x00, 0x47, 0x40, 0x00, 0x00, 0x1e, 0x01, 0x3c, 0x24, 0x00, 0x00, 0x00, 0x01, 0x48, 0x33, 0x00, 0x00, 0x3f, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x12, 0x01, 0x30, 0x1a, 0x00, 0x00, 0x0b, 0x00, 0x48, 0x40, 0x00, 0x00, 0x1d, 0x00, 0x30, 0x40, 0x00, 0x00, 0x2d, 0x01, 0x51, 0x3b, 0x00, 0x00, 0x05, 0x01, 0x40, 0x20, 0x00, 0x00, 0x0e, 0x00, 0x51, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4f, 0x3e, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4e, 0x40, 0x00, 0x00, 0x11, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4f, 0x4f, 0x00, 0x00, 0x0b, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4e, 0x49, 0x00, 0x00, 0x03, 0x01, 0x37, 0x2b, 0x00, 0x00, 0x12, 0x01, 0x4f, 0x53, 0x00, 0x00, 0x03, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x12, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x02, 0x01, 0x51, 0x4e, 0x00, 0x00, 0x12, 0x01, 0x4f, 0x4b, 0x00, 0x00, 0x04, 0x00, 0x51, 0x40, 0x00, 0x00, 0x04, 0x00, 0x37, 0x40, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x0a, 0x01, 0x4f, 0x60, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x35, 0x00, 0x00, 0x16, 0x01, 0x4d, 0x4c, 0x00, 0x00, 0x07, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4c, 0x4b, 0x00, 0x00, 0x0d, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4d, 0x4e, 0x00, 0x00, 0x0e, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4c, 0x4e, 0x00, 0x00, 0x03, 0x01, 0x37, 0x2e, 0x00, 0x00, 0x09, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x08, 0x01, 0x4d, 0x4b, 0x00, 0x00, 0x09, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x07, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4f, 0x50, 0x00, 0x00, 0x0f, 0x01, 0x4d, 0x48, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x06, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x37, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4d, 0x47, 0x00, 0x00, 0x03, 0x01, 0x3c, 0x2d, 0x00, 0x00, 0x14, 0x01, 0x4c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4b, 0x42, 0x00, 0x00, 0x12, 0x01, 0x4c, 0x41, 0x00, 0x00, 0x01, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x0d, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4b, 0x36, 0x00, 0x00, 0x05, 0x01, 0x37, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x44, 0x00, 0x00, 0x07, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x07, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x09, 0x01, 0x4d, 0x43, 0x00, 0x00, 0x11, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4c, 0x37, 0x00, 0x00, 0x0a, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x08, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x41, 0x27, 0x00, 0x00, 0x04, 0x01, 0x4c, 0x3f, 0x00, 0x00, 0x12, 0x01, 0x4a, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x06, 0x01, 0x49, 0x3a, 0x00, 0x00, 0x12, 0x00, 0x49, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4a, 0x40, 0x00, 0x00, 0x0f, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x03, 0x01, 0x37, 0x2f, 0x00, 0x00, 0x03, 0x01, 0x49, 0x37, 0x00, 0x00, 0x11, 0x00, 0x49, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4a, 0x43, 0x00, 0x00, 0x0d, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x41, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4c, 0x40, 0x00, 0x00, 0x09, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x09, 0x01, 0x4a, 0x4d, 0x00, 0x00, 0x0e, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x09, 0x01, 0x40, 0x2f, 0x00, 0x00, 0x03, 0x01, 0x51, 0x56, 0x00, 0x00, 0x03, 0x01, 0x37, 0x2f, 0x00, 0x00, 0x10, 0x01, 0x4f, 0x58, 0x00, 0x00, 0x08, 0x00, 0x51, 0x40, 0x00, 0x00, 0x08, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4e, 0x4c, 0x00, 0x00, 0x0c, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x04, 0x01, 0x4f, 0x51, 0x00, 0x00, 0x16, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x04, 0x01, 0x58, 0x4d, 0x00, 0x00, 0x15, 0x01, 0x54, 0x53, 0x00, 0x00, 0x00, 0x00, 0x58, 0x40, 0x00, 0x00, 0x15, 0x01, 0x51, 0x4c, 0x00, 0x00, 0x02, 0x00, 0x54, 0x40, 0x00, 0x00, 0x06, 0x00, 0x37, 0x40, 0x00, 0x00, 0x01, 0x00, 0x40, 0x40, 0x00, 0x00, 0x04, 0x00, 0x51, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4f, 0x53, 0x00, 0x00, 0x09, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x4f, 0x54, 0x00, 0x00, 0x02, 0x01, 0x3e, 0x34, 0x00, 0x00, 0x07, 0x01, 0x37, 0x2b, 0x00, 0x00, 0x0d, 0x01, 0x4d, 0x4a, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4c, 0x49, 0x00, 0x00, 0x0b, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x09, 0x01, 0x4d, 0x50, 0x00, 0x00, 0x0e, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x0a, 0x01, 0x56, 0x4c, 0x00, 0x00, 0x14, 0x01, 0x53, 0x5c, 0x00, 0x00, 0x01, 0x00, 0x56, 0x40, 0x00, 0x00, 0x0b, 0x00, 0x53, 0x40, 0x00, 0x00, 0x09, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4f, 0x43, 0x00, 0x00, 0x0a, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4d, 0x4b, 0x00, 0x00, 0x08, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x06, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4d, 0x4e, 0x00, 0x00, 0x03, 0x01, 0x3c, 0x2c, 0x00, 0x00, 0x03, 0x01, 0x37, 0x24, 0x00, 0x00, 0x0f, 0x01, 0x4c, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4b, 0x4a, 0x00, 0x00, 0x0d, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4c, 0x47, 0x00, 0x00, 0x0a, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x04, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x09, 0x01, 0x54, 0x4d, 0x00, 0x00, 0x0e, 0x00, 0x54, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4f, 0x3d, 0x00, 0x00, 0x0d, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4d, 0x3f, 0x00, 0x00, 0x0b, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x07, 0x01, 0x3c, 0x16, 0x00, 0x00, 0x00, 0x01, 0x4c, 0x33, 0x00, 0x00, 0x10, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x02, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x40, 0x28, 0x00, 0x00, 0x03, 0x01, 0x4f, 0x42, 0x00, 0x00, 0x05, 0x01, 0x37, 0x22, 0x00, 0x00, 0x46, 0x00, 0x40, 0x40, 0x00, 0x00, 0x04, 0x01, 0x4c, 0x2b, 0x00, 0x00, 0x03, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x05, 0x01, 0x3c, 0x15, 0x00, 0x00, 0x08, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x08, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x09, 0x01, 0x4a, 0x18, 0x00, 0x00, 0x04, 0x01, 0x3b, 0x0f, 0x00, 0x00, 0x21, 0x00, 0x37, 0x40, 0x00, 0x00, 0x1d, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x05, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x15, 0x01, 0x30, 0x28, 0x00, 0x00, 0x06, 0x01, 0x4a, 0x36, 0x00, 0x00, 0x0d, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x06, 0x01, 0x48, 0x2c, 0x00, 0x00, 0x0d, 0x00, 0x48, 0x40, 0x00, 0x00, 0x06, 0x01, 0x47, 0x33, 0x00, 0x00, 0x0d, 0x00, 0x47, 0x40, 0x00, 0x00, 0x03, 0x01, 0x48, 0x30, 0x00, 0x00, 0x10, 0x00, 0x30, 0x40, 0x00, 0x00, 0x03, 0x00, 0x48, 0x40, 0x00, 0x00, 0x03, 0x01, 0x3c, 0x29, 0x00, 0x00, 0x05, 0x01, 0x47, 0x32, 0x00, 0x00, 0x0c, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x48, 0x39, 0x00, 0x00, 0x0d, 0x00, 0x48, 0x40, 0x00, 0x00, 0x08, 0x01, 0x47, 0x33, 0x00, 0x00, 0x0b, 0x00, 0x47, 0x40, 0x00, 0x00, 0x09, 0x01, 0x48, 0x4e, 0x00, 0x00, 0x0b, 0x00, 0x48, 0x40, 0x00, 0x00, 0x07, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x08, 0x01, 0x51, 0x51, 0x00, 0x00, 0x05, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x0e, 0x01, 0x4f, 0x52, 0x00, 0x00, 0x02, 0x00, 0x51, 0x40, 0x00, 0x00, 0x0b, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4e, 0x49, 0x00, 0x00, 0x15, 0x01, 0x4f, 0x54, 0x00, 0x00, 0x01, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x10, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4e, 0x41, 0x00, 0x00, 0x02, 0x01, 0x3c, 0x25, 0x00, 0x00, 0x05, 0x00, 0x40, 0x40, 0x00, 0x00, 0x0b, 0x01, 0x4f, 0x55, 0x00, 0x00, 0x02, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x0e, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4e, 0x4d, 0x00, 0x00, 0x14, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4f, 0x5d, 0x00, 0x00, 0x0b, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x01, 0x50, 0x59, 0x00, 0x00, 0x01, 0x01, 0x41, 0x29, 0x00, 0x00, 0x13, 0x01, 0x51, 0x59, 0x00, 0x00, 0x04, 0x00, 0x50, 0x40, 0x00, 0x00, 0x10, 0x00, 0x51, 0x40, 0x00, 0x00, 0x00, 0x01, 0x54, 0x58, 0x00, 0x00, 0x14, 0x01, 0x53, 0x68, 0x00, 0x00, 0x04, 0x00, 0x54, 0x40, 0x00, 0x00, 0x0e, 0x00, 0x53, 0x40, 0x00, 0x00, 0x04, 0x01, 0x56, 0x58, 0x00, 0x00, 0x02, 0x00, 0x41, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3c, 0x22, 0x00, 0x00, 0x13, 0x01, 0x54, 0x4c, 0x00, 0x00, 0x06, 0x00, 0x56, 0x40, 0x00, 0x00, 0x09, 0x00, 0x54, 0x40, 0x00, 0x00, 0x02, 0x01, 0x53, 0x5e, 0x00, 0x00, 0x0c, 0x00, 0x53, 0x40, 0x00, 0x00, 0x07, 0x01, 0x51, 0x47, 0x00, 0x00, 0x09, 0x00, 0x51, 0x40, 0x00, 0x00, 0x02, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x09, 0x01, 0x40, 0x21, 0x00, 0x00, 0x03, 0x01, 0x51, 0x45, 0x00, 0x00, 0x0f, 0x00, 0x51, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4f, 0x4e, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x0b, 0x01, 0x58, 0x45, 0x00, 0x00, 0x14, 0x00, 0x58, 0x40, 0x00, 0x00, 0x01, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x56, 0x41, 0x00, 0x00, 0x11, 0x00, 0x56, 0x40, 0x00, 0x00, 0x03, 0x01, 0x54, 0x38, 0x00, 0x00, 0x11, 0x00, 0x54, 0x40, 0x00, 0x00, 0x03, 0x01, 0x53, 0x4e, 0x00, 0x00, 0x0d, 0x00, 0x53, 0x40, 0x00, 0x00, 0x06, 0x01, 0x51, 0x32, 0x00, 0x00, 0x0f, 0x00, 0x51, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x3e, 0x00, 0x00, 0x04, 0x01, 0x4f, 0x42, 0x00, 0x00, 0x0a, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x0d, 0x01, 0x3e, 0x45, 0x00, 0x00, 0x10, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4d, 0x45, 0x00, 0x00, 0x10, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x07, 0x01, 0x56, 0x4a, 0x00, 0x00, 0x0e, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x06, 0x00, 0x56, 0x40, 0x00, 0x00, 0x03, 0x01, 0x54, 0x4c, 0x00, 0x00, 0x14, 0x01, 0x53, 0x55, 0x00, 0x00, 0x01, 0x00, 0x54, 0x40, 0x00, 0x00, 0x13, 0x01, 0x51, 0x46, 0x00, 0x00, 0x02, 0x00, 0x53, 0x40, 0x00, 0x00, 0x0e, 0x00, 0x51, 0x40, 0x00, 0x00, 0x04, 0x01, 0x4f, 0x49, 0x00, 0x00, 0x14, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x04, 0x01, 0x4d, 0x47, 0x00, 0x00, 0x04, 0x01, 0x3b, 0x2a, 0x00, 0x00, 0x0c, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x3c, 0x26, 0x00, 0x00, 0x04, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4c, 0x3c, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x09, 0x00, 0x00, 0x09, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x07, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x0a, 0x01, 0x54, 0x42, 0x00, 0x00, 0x0c, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x02, 0x00, 0x54, 0x40, 0x00, 0x00, 0x05, 0x01, 0x53, 0x56, 0x00, 0x00, 0x0e, 0x00, 0x53, 0x40, 0x00, 0x00, 0x07, 0x01, 0x51, 0x37, 0x00, 0x00, 0x11, 0x01, 0x4f, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x51, 0x40, 0x00, 0x00, 0x0d, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4d, 0x35, 0x00, 0x00, 0x0d, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x05, 0x01, 0x39, 0x21, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x40, 0x00, 0x00, 0x0d, 0x00, 0x39, 0x40, 0x00, 0x00, 0x0d, 0x01, 0x35, 0x48, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x44, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x18, 0x00, 0x35, 0x40, 0x00, 0x00, 0x06, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x0b, 0x01, 0x51, 0x32, 0x00, 0x00, 0x25, 0x00, 0x51, 0x40, 0x00, 0x00, 0x02, 0x01, 0x37, 0x34, 0x00, 0x00, 0x01, 0x01, 0x4f, 0x38, 0x00, 0x00, 0x0b, 0x00, 0x37, 0x40, 0x00, 0x00, 0x17, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x04, 0x01, 0x47, 0x3d, 0x00, 0x00, 0x0f, 0x00, 0x47, 0x40, 0x00, 0x00, 0x1d, 0x01, 0x3c, 0x1e, 0x00, 0x00, 0x03, 0x01, 0x48, 0x37, 0x00, 0x00, 0x42, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x0f, 0x01, 0x30, 0x1e, 0x00, 0x00, 0x0b, 0x00, 0x48, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x30, 0x40, 0x00, 0x00, 0x7c, 0x01, 0x48, 0x53, 0x00, 0x00, 0x02, 0x01, 0x24, 0x58, 0x00, 0x00, 0x00, 0x01, 0x40, 0x51, 0x00, 0x00, 0x00, 0x01, 0x43, 0x46, 0x00, 0x00, 0x1a, 0x01, 0x28, 0x55, 0x00, 0x00, 0x02, 0x00, 0x24, 0x40, 0x00, 0x00, 0x11, 0x00, 0x40, 0x40, 0x00, 0x00, 0x09, 0x00, 0x28, 0x40, 0x00, 0x00, 0x02, 0x01, 0x2b, 0x4b, 0x00, 0x00, 0x02, 0x00, 0x48, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x43, 0x40, 0x00, 0x00, 0x06, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x06, 0x01, 0x30, 0x4b, 0x00, 0x00, 0x04, 0x01, 0x48, 0x57, 0x00, 0x00, 0x16, 0x00, 0x30, 0x40, 0x00, 0x00, 0x02, 0x01, 0x34, 0x52, 0x00, 0x00, 0x18, 0x00, 0x34, 0x40, 0x00, 0x00, 0x04, 0x01, 0x30, 0x4d, 0x00, 0x00, 0x0a, 0x00, 0x48, 0x40, 0x00, 0x00, 0x10, 0x00, 0x30, 0x40, 0x00, 0x00, 0x03, 0x01, 0x48, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x4f, 0x64, 0x00, 0x00, 0x03, 0x01, 0x24, 0x5e, 0x00, 0x00, 0x1d, 0x01, 0x28, 0x5a, 0x00, 0x00, 0x01, 0x00, 0x24, 0x40, 0x00, 0x00, 0x1b, 0x01, 0x2b, 0x4f, 0x00, 0x00, 0x02, 0x00, 0x28, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x03, 0x01, 0x30, 0x49, 0x00, 0x00, 0x03, 0x01, 0x4f, 0x64, 0x00, 0x00, 0x17, 0x00, 0x30, 0x40, 0x00, 0x00, 0x05, 0x01, 0x34, 0x52, 0x00, 0x00, 0x17, 0x00, 0x34, 0x40, 0x00, 0x00, 0x04, 0x01, 0x30, 0x4d, 0x00, 0x00, 0x05, 0x00, 0x48, 0x40, 0x00, 0x00, 0x04, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x10, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4f, 0x5a, 0x00, 0x00, 0x02, 0x01, 0x51, 0x5f, 0x00, 0x00, 0x01, 0x01, 0x48, 0x56, 0x00, 0x00, 0x02, 0x01, 0x24, 0x5d, 0x00, 0x00, 0x1d, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x01, 0x29, 0x4e, 0x00, 0x00, 0x1f, 0x01, 0x2d, 0x49, 0x00, 0x00, 0x03, 0x00, 0x29, 0x40, 0x00, 0x00, 0x15, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4d, 0x5b, 0x00, 0x00, 0x00, 0x01, 0x30, 0x4f, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x10, 0x00, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x5b, 0x00, 0x00, 0x16, 0x00, 0x35, 0x40, 0x00, 0x00, 0x05, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x01, 0x00, 0x48, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x4d, 0x00, 0x00, 0x1a, 0x01, 0x4f, 0x66, 0x00, 0x00, 0x01, 0x01, 0x4d, 0x60, 0x00, 0x00, 0x00, 0x00, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x48, 0x50, 0x00, 0x00, 0x03, 0x01, 0x24, 0x5a, 0x00, 0x00, 0x0b, 0x00, 0x51, 0x40, 0x00, 0x00, 0x12, 0x01, 0x28, 0x5e, 0x00, 0x00, 0x02, 0x00, 0x24, 0x40, 0x00, 0x00, 0x1b, 0x01, 0x2b, 0x4f, 0x00, 0x00, 0x04, 0x00, 0x28, 0x40, 0x00, 0x00, 0x11, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4c, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x30, 0x53, 0x00, 0x00, 0x09, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x0f, 0x00, 0x30, 0x40, 0x00, 0x00, 0x03, 0x01, 0x34, 0x57, 0x00, 0x00, 0x10, 0x00, 0x48, 0x40, 0x00, 0x00, 0x03, 0x00, 0x34, 0x40, 0x00, 0x00, 0x06, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x51, 0x00, 0x00, 0x0b, 0x00, 0x30, 0x40, 0x00, 0x00, 0x12, 0x01, 0x21, 0x75, 0x00, 0x00, 0x00, 0x01, 0x4d, 0x56, 0x00, 0x00, 0x01, 0x01, 0x48, 0x49, 0x00, 0x00, 0x00, 0x01, 0x4c, 0x4c, 0x00, 0x00, 0x07, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x21, 0x40, 0x00, 0x00, 0x0b, 0x01, 0x2c, 0x52, 0x00, 0x00, 0x09, 0x00, 0x48, 0x40, 0x00, 0x00, 0x0b, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x06, 0x01, 0x2d, 0x55, 0x00, 0x00, 0x0d, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x0b, 0x01, 0x4d, 0x52, 0x00, 0x00, 0x01, 0x01, 0x23, 0x75, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x5b, 0x00, 0x00, 0x02, 0x01, 0x43, 0x53, 0x00, 0x00, 0x0e, 0x00, 0x23, 0x40, 0x00, 0x00, 0x17, 0x01, 0x2d, 0x29, 0x00, 0x00, 0x0f, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x43, 0x40, 0x00, 0x00, 0x01, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x05, 0x01, 0x24, 0x70, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x53, 0x00, 0x00, 0x01, 0x01, 0x4a, 0x59, 0x00, 0x00, 0x01, 0x01, 0x43, 0x47, 0x00, 0x00, 0x04, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x09, 0x00, 0x24, 0x40, 0x00, 0x00, 0x10, 0x01, 0x2f, 0x56, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x43, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x4b, 0x00, 0x00, 0x03, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x30, 0x40, 0x00, 0x00, 0x0e, 0x01, 0x21, 0x6d, 0x00, 0x00, 0x02, 0x01, 0x48, 0x51, 0x00, 0x00, 0x00, 0x01, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4c, 0x55, 0x00, 0x00, 0x0f, 0x00, 0x21, 0x40, 0x00, 0x00, 0x0d, 0x01, 0x2c, 0x5a, 0x00, 0x00, 0x0c, 0x00, 0x45, 0x40, 0x00, 0x00, 0x06, 0x00, 0x48, 0x40, 0x00, 0x00, 0x09, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x02, 0x01, 0x2d, 0x58, 0x00, 0x00, 0x0d, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x0e, 0x01, 0x1d, 0x6e, 0x00, 0x00, 0x01, 0x01, 0x4a, 0x55, 0x00, 0x00, 0x00, 0x01, 0x45, 0x40, 0x00, 0x00, 0x01, 0x01, 0x48, 0x4c, 0x00, 0x00, 0x05, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x07, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x10, 0x01, 0x28, 0x69, 0x00, 0x00, 0x05, 0x00, 0x48, 0x40, 0x00, 0x00, 0x07, 0x00, 0x45, 0x40, 0x00, 0x00, 0x08, 0x00, 0x28, 0x40, 0x00, 0x00, 0x06, 0x01, 0x29, 0x61, 0x00, 0x00, 0x06, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x29, 0x40, 0x00, 0x00, 0x07, 0x01, 0x4a, 0x45, 0x00, 0x00, 0x01, 0x01, 0x1f, 0x6e, 0x00, 0x00, 0x01, 0x01, 0x47, 0x54, 0x00, 0x00, 0x01, 0x01, 0x41, 0x44, 0x00, 0x00, 0x11, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x0d, 0x01, 0x2a, 0x57, 0x00, 0x00, 0x07, 0x00, 0x41, 0x40, 0x00, 0x00, 0x0f, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x04, 0x01, 0x2b, 0x58, 0x00, 0x00, 0x01, 0x00, 0x47, 0x40, 0x00, 0x00, 0x13, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x07, 0x01, 0x24, 0x6b, 0x00, 0x00, 0x00, 0x01, 0x40, 0x48, 0x00, 0x00, 0x01, 0x01, 0x43, 0x47, 0x00, 0x00, 0x01, 0x01, 0x48, 0x4c, 0x00, 0x00, 0x05, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x0b, 0x00, 0x24, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x28, 0x57, 0x00, 0x00, 0x0a, 0x00, 0x28, 0x40, 0x00, 0x00, 0x13, 0x01, 0x2b, 0x59, 0x00, 0x00, 0x09, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x17, 0x01, 0x30, 0x60, 0x00, 0x00, 0x13, 0x00, 0x43, 0x40, 0x00, 0x00, 0x07, 0x00, 0x30, 0x40, 0x00, 0x00, 0x12, 0x00, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x48, 0x40, 0x00, 0x00, 0x24, 0x01, 0x48, 0x56, 0x00, 0x00, 0x01, 0x01, 0x43, 0x4e, 0x00, 0x00, 0x01, 0x01, 0x40, 0x4f, 0x00, 0x00, 0x04, 0x01, 0x24, 0x5c, 0x00, 0x00, 0x15, 0x01, 0x28, 0x67, 0x00, 0x00, 0x09, 0x00, 0x24, 0x40, 0x00, 0x00, 0x13, 0x01, 0x2b, 0x56, 0x00, 0x00, 0x04, 0x00, 0x28, 0x40, 0x00, 0x00, 0x05, 0x00, 0x40, 0x40, 0x00, 0x00, 0x02, 0x00, 0x48, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x43, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x05, 0x01, 0x48, 0x4e, 0x00, 0x00, 0x01, 0x01, 0x30, 0x52, 0x00, 0x00, 0x18, 0x00, 0x30, 0x40, 0x00, 0x00, 0x04, 0x01, 0x34, 0x60, 0x00, 0x00, 0x12, 0x00, 0x34, 0x40, 0x00, 0x00, 0x06, 0x01, 0x30, 0x59, 0x00, 0x00, 0x0d, 0x00, 0x48, 0x40, 0x00, 0x00, 0x08, 0x00, 0x30, 0x40, 0x00, 0x00, 0x07, 0x01, 0x24, 0x6d, 0x00, 0x00, 0x01, 0x01, 0x48, 0x50, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x5b, 0x00, 0x00, 0x00, 0x01, 0x4f, 0x6a, 0x00, 0x00, 0x18, 0x01, 0x28, 0x66, 0x00, 0x00, 0x03, 0x00, 0x24, 0x40, 0x00, 0x00, 0x18, 0x00, 0x28, 0x40, 0x00, 0x00, 0x03, 0x01, 0x2b, 0x56, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x07, 0x01, 0x30, 0x52, 0x00, 0x00, 0x03, 0x01, 0x4f, 0x62, 0x00, 0x00, 0x17, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x34, 0x62, 0x00, 0x00, 0x15, 0x00, 0x34, 0x40, 0x00, 0x00, 0x05, 0x01, 0x30, 0x58, 0x00, 0x00, 0x05, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x00, 0x48, 0x40, 0x00, 0x00, 0x02, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x0d, 0x00, 0x30, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4f, 0x58, 0x00, 0x00, 0x01, 0x01, 0x51, 0x64, 0x00, 0x00, 0x01, 0x01, 0x24, 0x67, 0x00, 0x00, 0x00, 0x01, 0x48, 0x59, 0x00, 0x00, 0x19, 0x01, 0x29, 0x66, 0x00, 0x00, 0x07, 0x00, 0x24, 0x40, 0x00, 0x00, 0x16, 0x00, 0x29, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2d, 0x5d, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x06, 0x01, 0x30, 0x55, 0x00, 0x00, 0x02, 0x01, 0x4d, 0x59, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x0e, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x6b, 0x00, 0x00, 0x14, 0x00, 0x35, 0x40, 0x00, 0x00, 0x03, 0x00, 0x48, 0x40, 0x00, 0x00, 0x02, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x02, 0x01, 0x30, 0x57, 0x00, 0x00, 0x17, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4f, 0x65, 0x00, 0x00, 0x02, 0x01, 0x48, 0x53, 0x00, 0x00, 0x00, 0x01, 0x24, 0x67, 0x00, 0x00, 0x00, 0x01, 0x4d, 0x63, 0x00, 0x00, 0x0b, 0x00, 0x51, 0x40, 0x00, 0x00, 0x0e, 0x01, 0x28, 0x63, 0x00, 0x00, 0x06, 0x00, 0x24, 0x40, 0x00, 0x00, 0x19, 0x01, 0x2b, 0x50, 0x00, 0x00, 0x03, 0x00, 0x28, 0x40, 0x00, 0x00, 0x11, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x06, 0x01, 0x30, 0x4f, 0x00, 0x00, 0x03, 0x01, 0x4c, 0x4b, 0x00, 0x00, 0x05, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x11, 0x00, 0x30, 0x40, 0x00, 0x00, 0x03, 0x01, 0x34, 0x59, 0x00, 0x00, 0x0a, 0x00, 0x48, 0x40, 0x00, 0x00, 0x04, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x09, 0x01, 0x30, 0x49, 0x00, 0x00, 0x0a, 0x00, 0x30, 0x40, 0x00, 0x00, 0x13, 0x01, 0x4c, 0x4f, 0x00, 0x00, 0x01, 0x01, 0x21, 0x69, 0x00, 0x00, 0x00, 0x01, 0x4d, 0x4c, 0x00, 0x00, 0x01, 0x01, 0x48, 0x46, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x40, 0x00, 0x00, 0x07, 0x00, 0x21, 0x40, 0x00, 0x00, 0x15, 0x01, 0x2c, 0x57, 0x00, 0x00, 0x06, 0x00, 0x48, 0x40, 0x00, 0x00, 0x0e, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x02, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x05, 0x01, 0x2d, 0x4e, 0x00, 0x00, 0x08, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x07, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x0b, 0x01, 0x4d, 0x4d, 0x00, 0x00, 0x01, 0x01, 0x23, 0x68, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x62, 0x00, 0x00, 0x02, 0x01, 0x43, 0x59, 0x00, 0x00, 0x09, 0x00, 0x23, 0x40, 0x00, 0x00, 0x13, 0x01, 0x2e, 0x48, 0x00, 0x00, 0x13, 0x00, 0x2e, 0x40, 0x00, 0x00, 0x04, 0x01, 0x2f, 0x47, 0x00, 0x00, 0x02, 0x00, 0x43, 0x40, 0x00, 0x00, 0x04, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x0f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x07, 0x01, 0x24, 0x64, 0x00, 0x00, 0x02, 0x01, 0x4c, 0x51, 0x00, 0x00, 0x02, 0x01, 0x43, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x58, 0x00, 0x00, 0x04, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x08, 0x00, 0x24, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x2f, 0x57, 0x00, 0x00, 0x14, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x07, 0x01, 0x30, 0x51, 0x00, 0x00, 0x03, 0x00, 0x43, 0x40, 0x00, 0x00, 0x03, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x09, 0x00, 0x30, 0x40, 0x00, 0x00, 0x0f, 0x01, 0x21, 0x59, 0x00, 0x00, 0x01, 0x01, 0x48, 0x50, 0x00, 0x00, 0x00, 0x01, 0x45, 0x43, 0x00, 0x00, 0x02, 0x01, 0x4c, 0x4f, 0x00, 0x00, 0x02, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x07, 0x00, 0x21, 0x40, 0x00, 0x00, 0x11, 0x01, 0x2c, 0x56, 0x00, 0x00, 0x0a, 0x00, 0x48, 0x40, 0x00, 0x00, 0x02, 0x00, 0x45, 0x40, 0x00, 0x00, 0x10, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x59, 0x00, 0x00, 0x0f, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x0c, 0x01, 0x48, 0x53, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x56, 0x00, 0x00, 0x01, 0x01, 0x1d, 0x6f, 0x00, 0x00, 0x00, 0x01, 0x45, 0x41, 0x00, 0x00, 0x04, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x0b, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x0f, 0x01, 0x28, 0x68, 0x00, 0x00, 0x02, 0x00, 0x48, 0x40, 0x00, 0x00, 0x08, 0x00, 0x45, 0x40, 0x00, 0x00, 0x08, 0x00, 0x28, 0x40, 0x00, 0x00, 0x05, 0x01, 0x29, 0x5a, 0x00, 0x00, 0x09, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x00, 0x00, 0x05, 0x01, 0x4a, 0x48, 0x00, 0x00, 0x01, 0x01, 0x47, 0x58, 0x00, 0x00, 0x02, 0x01, 0x1f, 0x66, 0x00, 0x00, 0x00, 0x01, 0x41, 0x44, 0x00, 0x00, 0x13, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x0b, 0x01, 0x2a, 0x4d, 0x00, 0x00, 0x05, 0x00, 0x41, 0x40, 0x00, 0x00, 0x07, 0x00, 0x47, 0x40, 0x00, 0x00, 0x0b, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x01, 0x2b, 0x4a, 0x00, 0x00, 0x0c, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x08, 0x01, 0x40, 0x44, 0x00, 0x00, 0x01, 0x01, 0x48, 0x43, 0x00, 0x00, 0x01, 0x01, 0x43, 0x41, 0x00, 0x00, 0x01, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x60, 0x00, 0x00, 0x14, 0x00, 0x24, 0x40, 0x00, 0x00, 0x05, 0x01, 0x28, 0x5b, 0x00, 0x00, 0x10, 0x00, 0x28, 0x40, 0x00, 0x00, 0x08, 0x01, 0x2b, 0x51, 0x00, 0x00, 0x0e, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x13, 0x01, 0x30, 0x54, 0x00, 0x00, 0x04, 0x00, 0x48, 0x40, 0x00, 0x00, 0x08, 0x00, 0x40, 0x40, 0x00, 0x00, 0x08, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x00, 0x43, 0x40, 0x00
 
 };
+const uint32_t EVENT_COUNT_1 = SONG_EVENT_COUNT(SONG1_DATA);
+SONG_VALIDATE(SONG1_DATA);
 
 // --- Song 2 Definition ---  La Bamba
-const uint16_t EVENT_COUNT_2 = 728;  // !! SET EVENT COUNT FOR SONG 2 !!
 const float BPM_2 = 128.0f;         // !! SET BPM FOR SONG 2 !!
-const uint8_t SONG2_DATA[] PROGMEM = {
+constexpr uint8_t SONG2_DATA[] PROGMEM = {
 
 0x00, 0x00, 0x01, 0x2a, 0x64, 0x00, 0x00, 0x04, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x5c, 0x01, 0x2a, 0x4d, 0x00, 0x00, 0x04, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x5c, 0x01, 0x2a, 0x4d, 0x00, 0x00, 0x04, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x30, 0x01, 0x1f, 0x6d, 0x00, 0x00, 0x2c, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x01, 0x21, 0x6d, 0x00, 0x00, 0x2c, 0x00, 0x21, 0x40, 0x00, 0x00, 0x04, 0x01, 0x23, 0x6d, 0x00, 0x00, 0x2c, 0x00, 0x23, 0x40, 0x00, 0x00, 0x04, 0x01, 0x24, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x04, 0x01, 0x30, 0x45, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x37, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x30, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x45, 0x00, 0x00, 0x2c, 0x00, 0x30, 0x40, 0x00, 0x00, 0x03, 0x00, 0x37, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x45, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x39, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x45, 0x00, 0x00, 0x2c, 0x00, 0x30, 0x40, 0x00, 0x00, 0x03, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x30, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x04, 0x01, 0x32, 0x45, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x32, 0x40, 0x00, 0x00, 0x2d, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x01, 0x2b, 0x45, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x45, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x45, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x45, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x35, 0x45, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x34, 0x45, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x01, 0x26, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x32, 0x45, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x30, 0x45, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x45, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x34, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x45, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x2d, 0x00, 0x30, 0x40, 0x00, 0x00, 0x04, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x30, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x04, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x45, 0x00, 0x00, 0x2c, 0x00, 0x30, 0x40, 0x00, 0x00, 0x03, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x30, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x34, 0x01, 0x2b, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x32, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x37, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5e, 0x00, 0x00, 0x2c, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x35, 0x01, 0x4d, 0x4c, 0x00, 0x00, 0x26, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x09, 0x01, 0x4d, 0x47, 0x00, 0x00, 0x1e, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x13, 0x01, 0x4d, 0x4c, 0x00, 0x00, 0x49, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x14, 0x01, 0x4d, 0x4b, 0x00, 0x00, 0x28, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x0a, 0x01, 0x4c, 0x47, 0x00, 0x00, 0x30, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x26, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x09, 0x01, 0x48, 0x52, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x40, 0x00, 0x00, 0x00, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x09, 0x00, 0x48, 0x40, 0x00, 0x00, 0x26, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x04, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x30, 0x00, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x30, 0x01, 0x4d, 0x62, 0x00, 0x00, 0x20, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4d, 0x5c, 0x00, 0x00, 0x01, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x1a, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x12, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4d, 0x62, 0x00, 0x00, 0x01, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x18, 0x00, 0x29, 0x40, 0x00, 0x00, 0x12, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x05, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x03, 0x01, 0x4d, 0x5a, 0x00, 0x00, 0x22, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x07, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4d, 0x62, 0x00, 0x00, 0x2a, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x03, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x01, 0x26, 0x59, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x62, 0x00, 0x00, 0x2b, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2a, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x06, 0x01, 0x48, 0x64, 0x00, 0x00, 0x2c, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x40, 0x00, 0x00, 0x00, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x48, 0x40, 0x00, 0x00, 0x23, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x02, 0x01, 0x48, 0x65, 0x00, 0x00, 0x02, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x04, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x11, 0x00, 0x48, 0x40, 0x00, 0x00, 0x1c, 0x01, 0x48, 0x65, 0x00, 0x00, 0x02, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x40, 0x00, 0x00, 0x2a, 0x00, 0x48, 0x40, 0x00, 0x00, 0x02, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x64, 0x00, 0x00, 0x5c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x01, 0x1f, 0x59, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x16, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x18, 0x01, 0x47, 0x65, 0x00, 0x00, 0x02, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x01, 0x23, 0x59, 0x00, 0x00, 0x2c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x00, 0x23, 0x40, 0x00, 0x00, 0x00, 0x01, 0x26, 0x59, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x16, 0x00, 0x47, 0x40, 0x00, 0x00, 0x16, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x65, 0x00, 0x00, 0x03, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x29, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x03, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x02, 0x01, 0x4d, 0x62, 0x00, 0x00, 0x01, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x28, 0x00, 0x4d, 0x40, 0x00, 0x00, 0x06, 0x01, 0x4c, 0x62, 0x00, 0x00, 0x01, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x01, 0x26, 0x59, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x02, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x40, 0x00, 0x00, 0x00, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4c, 0x62, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x11, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x1b, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x37, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x00, 0x01, 0x48, 0x72, 0x00, 0x00, 0x2c, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x04, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x48, 0x40, 0x00, 0x00, 0x02, 0x01, 0x45, 0x6b, 0x00, 0x00, 0x01, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x40, 0x00, 0x00, 0x1d, 0x00, 0x45, 0x40, 0x00, 0x00, 0x0f, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x43, 0x66, 0x00, 0x00, 0x01, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x20, 0x00, 0x43, 0x40, 0x00, 0x00, 0x3c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x01, 0x26, 0x59, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x02, 0x01, 0x48, 0x69, 0x00, 0x00, 0x01, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x40, 0x00, 0x00, 0x00, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x01, 0x45, 0x5f, 0x00, 0x00, 0x01, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x08, 0x00, 0x48, 0x40, 0x00, 0x00, 0x24, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x04, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x40, 0x00, 0x00, 0x29, 0x00, 0x45, 0x40, 0x00, 0x00, 0x03, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x47, 0x6c, 0x00, 0x00, 0x02, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x43, 0x6c, 0x00, 0x00, 0x01, 0x01, 0x1f, 0x59, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x00, 0x47, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x01, 0x23, 0x59, 0x00, 0x00, 0x15, 0x00, 0x43, 0x40, 0x00, 0x00, 0x17, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x00, 0x23, 0x40, 0x00, 0x00, 0x00, 0x01, 0x26, 0x59, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x01, 0x26, 0x59, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x48, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x4c, 0x71, 0x00, 0x00, 0x02, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x40, 0x00, 0x00, 0x00, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x23, 0x00, 0x48, 0x40, 0x00, 0x00, 0x09, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x02, 0x01, 0x45, 0x55, 0x00, 0x00, 0x01, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x48, 0x6c, 0x00, 0x00, 0x01, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x29, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x00, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x2a, 0x00, 0x45, 0x40, 0x00, 0x00, 0x01, 0x00, 0x48, 0x40, 0x00, 0x00, 0x01, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x02, 0x01, 0x47, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x5d, 0x00, 0x00, 0x01, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x4a, 0x00, 0x47, 0x40, 0x00, 0x00, 0x0d, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x05, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x47, 0x68, 0x00, 0x00, 0x01, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x01, 0x43, 0x6d, 0x00, 0x00, 0x36, 0x00, 0x43, 0x40, 0x00, 0x00, 0x03, 0x00, 0x47, 0x40, 0x00, 0x00, 0x23, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x01, 0x26, 0x59, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x48, 0x65, 0x00, 0x00, 0x00, 0x01, 0x4c, 0x6b, 0x00, 0x00, 0x02, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x40, 0x00, 0x00, 0x00, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x22, 0x00, 0x48, 0x40, 0x00, 0x00, 0x0a, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x02, 0x01, 0x45, 0x5d, 0x00, 0x00, 0x01, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x48, 0x65, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x00, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x1c, 0x00, 0x48, 0x40, 0x00, 0x00, 0x01, 0x00, 0x45, 0x40, 0x00, 0x00, 0x0f, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x47, 0x67, 0x00, 0x00, 0x00, 0x01, 0x4a, 0x64, 0x00, 0x00, 0x02, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x4c, 0x00, 0x47, 0x40, 0x00, 0x00, 0x07, 0x00, 0x4a, 0x40, 0x00, 0x00, 0x09, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x62, 0x00, 0x00, 0x01, 0x01, 0x47, 0x6f, 0x00, 0x00, 0x01, 0x00, 0x37, 0x40, 0x00, 0x00, 0x01, 0x01, 0x1f, 0x59, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x26, 0x00, 0x47, 0x40, 0x00, 0x00, 0x04, 0x00, 0x43, 0x40, 0x00, 0x00, 0x06, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x00, 0x01, 0x23, 0x59, 0x00, 0x00, 0x2c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x04, 0x00, 0x23, 0x40, 0x00, 0x00, 0x00, 0x01, 0x26, 0x59, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x29, 0x59, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x01, 0x26, 0x59, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x01, 0x32, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x48, 0x65, 0x00, 0x00, 0x02, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x00, 0x26, 0x40, 0x00, 0x00, 0x00, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x5c, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x40, 0x00, 0x00, 0x00, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x02, 0x01, 0x45, 0x68, 0x00, 0x00, 0x01, 0x00, 0x37, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40, 0x00, 0x00, 0x2c, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x39, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x03, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x29, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x39, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x2f, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2d, 0x59, 0x00, 0x00, 0x00, 0x00, 0x35, 0x40, 0x00, 0x00, 0x00, 0x01, 0x35, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x45, 0x40, 0x00, 0x00, 0x0e, 0x01, 0x47, 0x67, 0x00, 0x00, 0x02, 0x00, 0x35, 0x40, 0x00, 0x00, 0x28, 0x00, 0x47, 0x40, 0x00, 0x00, 0x05, 0x00, 0x29, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x04, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x00, 0x01, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x34, 0x40, 0x00, 0x00, 0x00, 0x01, 0x37, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x40, 0x00, 0x00, 0x34, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x2b, 0x00, 0x30, 0x40, 0x00, 0x00, 0x01, 0x01, 0x34, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x01, 0x37, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x37, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x39, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x37, 0x39, 0x00, 0x00, 0x5f, 0x00, 0x37, 0x40, 0x00, 0x00, 0x31, 0x01, 0x2f, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x35, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x35, 0x40, 0x00, 0x00, 0x01, 0x01, 0x34, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x34, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x39, 0x00, 0x00, 0x2f, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x01, 0x24, 0x39, 0x00, 0x00, 0x00, 0x01, 0x30, 0x39, 0x00, 0x00, 0x00, 0x01, 0x34, 0x39, 0x00, 0x00, 0x00, 0x01, 0x37, 0x39, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x39, 0x00, 0x00, 0x34, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x37, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x40, 0x00, 0x00, 0x0c, 0x00, 0x24, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x30, 0x40, 0x00
 
 };
+const uint32_t EVENT_COUNT_2 = SONG_EVENT_COUNT(SONG2_DATA);
+SONG_VALIDATE(SONG2_DATA);
 
 // --- Song 3 Definition --- Strobe Simple
-const uint16_t EVENT_COUNT_3 = 250;  // !! SET EVENT COUNT FOR SONG 3 !!
 const float BPM_3 = 128.0f;          // !! SET BPM FOR SONG 3 !!
-const uint8_t SONG3_DATA[] PROGMEM = {
+constexpr uint8_t SONG3_DATA[] PROGMEM = {
   0x00, 0x00, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x30, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x39, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x39, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x23, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x23, 0x40, 0x00, 0x00, 0x01, 0x01, 0x23, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x23, 0x40, 0x00, 0x00, 0x01, 0x01, 0x23, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x23, 0x40, 0x00, 0x00, 0x01, 0x01, 0x23, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x23, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x40, 0x00, 0x00, 0x30, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x30, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x45, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x45, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x45, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x45, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x47, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x45, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x45, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x40, 0x00, 0x00, 0x30, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x30, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x01, 0x32, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x47, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x32, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x43, 0x40, 0x00, 0x00, 0x30, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x30, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x45, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x28, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x45, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x45, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x45, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x45, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x45, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x45, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x45, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x01, 0x01, 0x47, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x43, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x01, 0x00, 0x43, 0x40, 0x00
 
 };
+const uint32_t EVENT_COUNT_3 = SONG_EVENT_COUNT(SONG3_DATA);
+SONG_VALIDATE(SONG3_DATA);
 
 // --- Song 4 Definition --- Strobe Refined
-const uint16_t EVENT_COUNT_4 = 1236;
 const float BPM_4 = 128.0f;
-const uint8_t SONG4_DATA[] PROGMEM = {
+constexpr uint8_t SONG4_DATA[] PROGMEM = {
 
   0x00, 0x00, 0x01, 0x2c, 0x05, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x08, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x13, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x17, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x20, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x21, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x23, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x26, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x29, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x2d, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x32, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x37, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x3f, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x41, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x42, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x42, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x3e, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x44, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x01, 0x01, 0x44, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x3f, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x18, 0x01, 0x47, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x47, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x41, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x43, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x47, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x49, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x4c, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x3f, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3f, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x53, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x57, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x59, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x5c, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x53, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x56, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x59, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x5d, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x61, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x68, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x6b, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x70, 0x00, 0x00, 0x00, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x05, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x05, 0x00, 0x00, 0x2f, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x07, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x10, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x08, 0x00, 0x00, 0x00, 0x01, 0x49, 0x12, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x09, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x14, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x1a, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x50, 0x24, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x1c, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x01, 0x47, 0x2c, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x25, 0x00, 0x00, 0x00, 0x01, 0x49, 0x33, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x28, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x37, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x50, 0x39, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x3a, 0x00, 0x00, 0x2f, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x01, 0x01, 0x44, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2f, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x41, 0x00, 0x00, 0x2f, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x47, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x42, 0x3d, 0x00, 0x00, 0x00, 0x01, 0x4e, 0x43, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x64, 0x00, 0x00, 0x00, 0x01, 0x42, 0x40, 0x00, 0x00, 0x00, 0x01, 0x4e, 0x46, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x44, 0x00, 0x00, 0x00, 0x01, 0x50, 0x4a, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x3f, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3f, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x40, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x58, 0x00, 0x00, 0x18, 0x01, 0x40, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x5a, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x5a, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x47, 0x5f, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x63, 0x00, 0x00, 0x00, 0x01, 0x49, 0x63, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x68, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x68, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x6b, 0x00, 0x00, 0x00, 0x01, 0x50, 0x6b, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x42, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x42, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x42, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x2f, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x55, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x31, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x55, 0x00, 0x00, 0x00, 0x01, 0x44, 0x64, 0x00, 0x00, 0x00, 0x01, 0x49, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x31, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x31, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x55, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x31, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x00, 0x01, 0x46, 0x64, 0x00, 0x00, 0x00, 0x01, 0x50, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x31, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x55, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x31, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x31, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x31, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x36, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x55, 0x00, 0x00, 0x00, 0x01, 0x49, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x36, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x36, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x55, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x36, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x00, 0x01, 0x50, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x46, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x46, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x38, 0x55, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x18, 0x01, 0x50, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x50, 0x64, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x3b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x55, 0x00, 0x00, 0x00, 0x01, 0x49, 0x64, 0x00, 0x00, 0x18, 0x01, 0x53, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x00, 0x00, 0x00, 0x00, 0x53, 0x40, 0x00, 0x00, 0x01, 0x01, 0x53, 0x64, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x53, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x31, 0x64, 0x00, 0x00, 0x00, 0x01, 0x42, 0x55, 0x00, 0x00, 0x00, 0x01, 0x44, 0x64, 0x00, 0x00, 0x00, 0x01, 0x4e, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x31, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x31, 0x64, 0x00, 0x00, 0x00, 0x01, 0x42, 0x55, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x64, 0x00, 0x00, 0x00, 0x01, 0x4e, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x31, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x00, 0x01, 0x50, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4b, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4b, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4c, 0x64, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x28, 0x64, 0x00, 0x00, 0x00, 0x01, 0x34, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x00, 0x01, 0x46, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4c, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x31, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x55, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x31, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x25, 0x64, 0x00, 0x00, 0x00, 0x01, 0x31, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x25, 0x40, 0x00, 0x00, 0x00, 0x00, 0x31, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x36, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3d, 0x55, 0x00, 0x00, 0x00, 0x01, 0x49, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x49, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x36, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2a, 0x64, 0x00, 0x00, 0x00, 0x01, 0x36, 0x64, 0x00, 0x00, 0x00, 0x01, 0x3f, 0x55, 0x00, 0x00, 0x00, 0x01, 0x4b, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x3f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x36, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x44, 0x55, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x00, 0x01, 0x50, 0x55, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x64, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x64, 0x00, 0x00, 0x00, 0x01, 0x38, 0x64, 0x00, 0x00, 0x00, 0x01, 0x47, 0x64, 0x00, 0x00, 0x18, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x47, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x40, 0x00, 0x00, 0x18, 0x00, 0x2c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x00, 0x00, 0x01, 0x01, 0x4e, 0x2a, 0x00, 0x00, 0x17, 0x00, 0x4e, 0x40, 0x00
 
 };
+const uint32_t EVENT_COUNT_4 = SONG_EVENT_COUNT(SONG4_DATA);
+SONG_VALIDATE(SONG4_DATA);
 
 // --- Song 5 Definition --- Tetris A 1st Half
-const uint16_t EVENT_COUNT_5 = 896;
 const float BPM_5 = 135.0f;
-const uint8_t SONG5_DATA[] PROGMEM = {
+constexpr uint8_t SONG5_DATA[] PROGMEM = {
 
 0x00, 0x00, 0x01, 0x1c, 0x51, 0x00, 0x00, 0x00, 0x01, 0x28, 0x62, 0x00, 0x00, 0x00, 0x01, 0x58, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x64, 0x47, 0x00, 0x00, 0x30, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x37, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5e, 0x00, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x28, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x53, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x44, 0x00, 0x00, 0x2d, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x37, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x54, 0x39, 0x00, 0x00, 0x00, 0x01, 0x60, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x28, 0x60, 0x00, 0x00, 0x00, 0x01, 0x56, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x62, 0x45, 0x00, 0x00, 0x2d, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x37, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x64, 0x3f, 0x00, 0x00, 0x16, 0x00, 0x64, 0x00, 0x00, 0x00, 0x02, 0x01, 0x62, 0x3f, 0x00, 0x00, 0x15, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x01, 0x00, 0x62, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x28, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x54, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x60, 0x44, 0x00, 0x00, 0x2c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x37, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x53, 0x39, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x01, 0x21, 0x52, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x63, 0x00, 0x00, 0x00, 0x01, 0x51, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x47, 0x00, 0x00, 0x30, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x5e, 0x00, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x51, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x44, 0x00, 0x00, 0x2d, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x50, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x39, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x54, 0x39, 0x00, 0x00, 0x00, 0x01, 0x60, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x50, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x61, 0x00, 0x00, 0x00, 0x01, 0x58, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x64, 0x45, 0x00, 0x00, 0x2d, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x56, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x62, 0x44, 0x00, 0x00, 0x2c, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x01, 0x40, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x54, 0x39, 0x00, 0x00, 0x00, 0x01, 0x60, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0x01, 0x20, 0x52, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x63, 0x00, 0x00, 0x00, 0x01, 0x53, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x47, 0x00, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x38, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5e, 0x00, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x28, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x53, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x44, 0x00, 0x00, 0x2d, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x38, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x54, 0x39, 0x00, 0x00, 0x00, 0x01, 0x60, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x50, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x61, 0x00, 0x00, 0x00, 0x01, 0x56, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x62, 0x45, 0x00, 0x00, 0x2d, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x38, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x01, 0x40, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x28, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x64, 0x44, 0x00, 0x00, 0x2c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x38, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x50, 0x00, 0x00, 0x00, 0x01, 0x40, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x01, 0x21, 0x52, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x63, 0x00, 0x00, 0x00, 0x01, 0x54, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x60, 0x47, 0x00, 0x00, 0x30, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x50, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x5e, 0x00, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x00, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x21, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x51, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x44, 0x00, 0x00, 0x2d, 0x00, 0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x01, 0x40, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x50, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x61, 0x00, 0x00, 0x00, 0x01, 0x51, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x42, 0x00, 0x00, 0x2d, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x01, 0x40, 0x50, 0x00, 0x00, 0x00, 0x01, 0x45, 0x5e, 0x00, 0x00, 0x30, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x59, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x16, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x02, 0x01, 0x3b, 0x58, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x3f, 0x00, 0x00, 0x15, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x02, 0x01, 0x3c, 0x58, 0x00, 0x00, 0x00, 0x01, 0x60, 0x3f, 0x00, 0x00, 0x16, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3e, 0x58, 0x00, 0x00, 0x00, 0x01, 0x62, 0x3f, 0x00, 0x00, 0x17, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x02, 0x01, 0x34, 0x55, 0x00, 0x00, 0x00, 0x01, 0x40, 0x63, 0x00, 0x00, 0x00, 0x01, 0x58, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x64, 0x47, 0x00, 0x00, 0x30, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x26, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x29, 0x50, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x56, 0x39, 0x00, 0x00, 0x00, 0x01, 0x62, 0x43, 0x00, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x32, 0x51, 0x00, 0x00, 0x00, 0x01, 0x41, 0x5f, 0x00, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x26, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x29, 0x50, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x59, 0x39, 0x00, 0x00, 0x00, 0x01, 0x65, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x53, 0x00, 0x00, 0x00, 0x01, 0x45, 0x61, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x69, 0x45, 0x00, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x00, 0x00, 0x03, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x01, 0x26, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x29, 0x50, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x51, 0x00, 0x00, 0x00, 0x01, 0x39, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x67, 0x44, 0x00, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x29, 0x50, 0x00, 0x00, 0x00, 0x01, 0x35, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x59, 0x39, 0x00, 0x00, 0x00, 0x01, 0x65, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x02, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x01, 0x01, 0x24, 0x53, 0x00, 0x00, 0x00, 0x01, 0x30, 0x63, 0x00, 0x00, 0x00, 0x01, 0x58, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x64, 0x47, 0x00, 0x00, 0x30, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x5e, 0x00, 0x00, 0x2f, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x30, 0x5f, 0x00, 0x00, 0x2d, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x54, 0x39, 0x00, 0x00, 0x00, 0x01, 0x60, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x51, 0x00, 0x00, 0x00, 0x01, 0x30, 0x61, 0x00, 0x00, 0x00, 0x01, 0x58, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x64, 0x45, 0x00, 0x00, 0x2d, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x2b, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x56, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x62, 0x44, 0x00, 0x00, 0x2c, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x54, 0x39, 0x00, 0x00, 0x00, 0x01, 0x60, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0x01, 0x23, 0x53, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x63, 0x00, 0x00, 0x00, 0x01, 0x53, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x47, 0x00, 0x00, 0x30, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5e, 0x00, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x53, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x44, 0x00, 0x00, 0x2d, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5e, 0x00, 0x00, 0x00, 0x01, 0x54, 0x39, 0x00, 0x00, 0x00, 0x01, 0x60, 0x43, 0x00, 0x00, 0x2d, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x32, 0x53, 0x00, 0x00, 0x00, 0x01, 0x3e, 0x61, 0x00, 0x00, 0x00, 0x01, 0x56, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x62, 0x45, 0x00, 0x00, 0x2d, 0x00, 0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x4f, 0x00, 0x00, 0x00, 0x01, 0x34, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x51, 0x00, 0x00, 0x00, 0x01, 0x38, 0x51, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x58, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x64, 0x44, 0x00, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x50, 0x00, 0x00, 0x00, 0x01, 0x38, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0x01, 0x21, 0x52, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x63, 0x00, 0x00, 0x00, 0x01, 0x54, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x60, 0x47, 0x00, 0x00, 0x30, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x50, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x39, 0x5e, 0x00, 0x00, 0x2c, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x5f, 0x00, 0x00, 0x00, 0x01, 0x51, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x44, 0x00, 0x00, 0x2d, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x50, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x50, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x61, 0x00, 0x00, 0x00, 0x01, 0x51, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x42, 0x00, 0x00, 0x2d, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x50, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x50, 0x00, 0x00, 0x00, 0x01, 0x40, 0x5e, 0x00, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x21, 0x5f, 0x00, 0x00, 0x5e, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x01, 0x34, 0x48, 0x00, 0x00, 0x00, 0x01, 0x39, 0x48, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x48, 0x00, 0x00, 0x00, 0x01, 0x40, 0x56, 0x00, 0x00, 0x00, 0x01, 0x58, 0x44, 0x00, 0x00, 0x1b, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x01, 0x54, 0x40, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x46, 0x00, 0x00, 0x00, 0x01, 0x34, 0x46, 0x00, 0x00, 0x00, 0x01, 0x39, 0x46, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x54, 0x00, 0x00, 0x00, 0x01, 0x58, 0x42, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x01, 0x54, 0x40, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x32, 0x48, 0x00, 0x00, 0x00, 0x01, 0x34, 0x48, 0x00, 0x00, 0x00, 0x01, 0x38, 0x48, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x56, 0x00, 0x00, 0x00, 0x01, 0x58, 0x44, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x01, 0x56, 0x40, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x56, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x46, 0x00, 0x00, 0x00, 0x01, 0x34, 0x46, 0x00, 0x00, 0x00, 0x01, 0x38, 0x54, 0x00, 0x00, 0x00, 0x01, 0x58, 0x42, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x01, 0x53, 0x40, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x53, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0x01, 0x30, 0x48, 0x00, 0x00, 0x00, 0x01, 0x34, 0x48, 0x00, 0x00, 0x00, 0x01, 0x39, 0x48, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x56, 0x00, 0x00, 0x00, 0x01, 0x58, 0x44, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x01, 0x54, 0x40, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x46, 0x00, 0x00, 0x00, 0x01, 0x30, 0x46, 0x00, 0x00, 0x00, 0x01, 0x34, 0x46, 0x00, 0x00, 0x00, 0x01, 0x39, 0x54, 0x00, 0x00, 0x00, 0x01, 0x58, 0x42, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x01, 0x54, 0x40, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2c, 0x48, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x48, 0x00, 0x00, 0x00, 0x01, 0x34, 0x48, 0x00, 0x00, 0x00, 0x01, 0x38, 0x56, 0x00, 0x00, 0x00, 0x01, 0x58, 0x44, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x01, 0x56, 0x40, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x56, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x46, 0x00, 0x00, 0x00, 0x01, 0x34, 0x46, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x54, 0x00, 0x00, 0x00, 0x01, 0x58, 0x42, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x18, 0x01, 0x68, 0x40, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x68, 0x00, 0x00, 0x00, 0x16, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x17, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x01, 0x01, 0x34, 0x48, 0x00, 0x00, 0x00, 0x01, 0x39, 0x48, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x48, 0x00, 0x00, 0x00, 0x01, 0x40, 0x56, 0x00, 0x00, 0x00, 0x01, 0x58, 0x44, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x01, 0x54, 0x40, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x46, 0x00, 0x00, 0x00, 0x01, 0x34, 0x46, 0x00, 0x00, 0x00, 0x01, 0x39, 0x46, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x54, 0x00, 0x00, 0x00, 0x01, 0x58, 0x42, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x01, 0x54, 0x40, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x32, 0x48, 0x00, 0x00, 0x00, 0x01, 0x34, 0x48, 0x00, 0x00, 0x00, 0x01, 0x38, 0x48, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x56, 0x00, 0x00, 0x00, 0x01, 0x58, 0x44, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x01, 0x56, 0x40, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x56, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2f, 0x46, 0x00, 0x00, 0x00, 0x01, 0x34, 0x46, 0x00, 0x00, 0x00, 0x01, 0x38, 0x54, 0x00, 0x00, 0x00, 0x01, 0x58, 0x42, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x01, 0x53, 0x40, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x53, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0x01, 0x30, 0x48, 0x00, 0x00, 0x00, 0x01, 0x34, 0x48, 0x00, 0x00, 0x00, 0x01, 0x39, 0x48, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x56, 0x00, 0x00, 0x00, 0x01, 0x58, 0x44, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x44, 0x00, 0x00, 0x00, 0x01, 0x39, 0x44, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x44, 0x00, 0x00, 0x00, 0x01, 0x40, 0x52, 0x00, 0x00, 0x00, 0x01, 0x54, 0x40, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x46, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x46, 0x00, 0x00, 0x00, 0x01, 0x40, 0x46, 0x00, 0x00, 0x00, 0x01, 0x45, 0x54, 0x00, 0x00, 0x00, 0x01, 0x58, 0x42, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x01, 0x54, 0x40, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x17, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5d, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x16, 0x01, 0x51, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x16, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x01, 0x38, 0x43, 0x00, 0x00, 0x00, 0x01, 0x3b, 0x43, 0x00, 0x00, 0x00, 0x01, 0x40, 0x43, 0x00, 0x00, 0x00, 0x01, 0x44, 0x51, 0x00, 0x00, 0x00, 0x01, 0x58, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x50, 0x3f, 0x00, 0x00, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x40, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x41, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x01, 0x53, 0x42, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x43, 0x00, 0x00, 0x01, 0x00, 0x53, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x43, 0x00, 0x00, 0x01, 0x00, 0x50, 0x00, 0x00, 0x00, 0x16, 0x01, 0x50, 0x44, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x46, 0x00, 0x00, 0x00, 0x01, 0x23, 0x47, 0x00, 0x00, 0x00, 0x01, 0x28, 0x48, 0x00, 0x00, 0x00, 0x01, 0x2c, 0x57, 0x00, 0x00, 0x00, 0x01, 0x58, 0x45, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x17, 0x01, 0x50, 0x46, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x00, 0x00, 0x16, 0x01, 0x5c, 0x47, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0x15, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x5c, 0x47, 0x00, 0x00, 0x16, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x01, 0x01, 0x5d, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x69, 0x4e, 0x00, 0x00, 0x09, 0x01, 0x5b, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x67, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x59, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x65, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x09, 0x01, 0x58, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x56, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x62, 0x50, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x09, 0x01, 0x54, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x50, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x53, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x09, 0x01, 0x51, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x51, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x4f, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x5b, 0x51, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x4d, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00
 
 };
+const uint32_t EVENT_COUNT_5 = SONG_EVENT_COUNT(SONG5_DATA);
+SONG_VALIDATE(SONG5_DATA);
 
 
-// --- Song Information Structure ---
-// Holds metadata for one song stored in PROGMEM
-struct SongInfo {
-  const uint8_t* midi_data_ptr;  // Pointer to the PROGMEM data array
-  uint16_t event_count;
-  float bpm;
-};
-
 // --- Master Song List (in PROGMEM) ---
 // This array holds the metadata for all defined songs.
-const SongInfo song_list[SONG_COUNT] PROGMEM = {
-  { SONG1_DATA, EVENT_COUNT_1, BPM_1 },  // Entry for Song 1
-  { SONG2_DATA, EVENT_COUNT_2, BPM_2 },  // Entry for Song 2
-  { SONG3_DATA, EVENT_COUNT_3, BPM_3 },
-  { SONG4_DATA, EVENT_COUNT_4, BPM_4 },
-  { SONG5_DATA, EVENT_COUNT_5, BPM_5 },
+const SongInfo song_list[] PROGMEM = {
+  { SONG1_DATA, EVENT_COUNT_1, BPM_1, SONG_FORMAT_RAW, "Twinkle Twinkle", 59225, sizeof(SONG1_DATA) },  // Entry for Song 1
+  { SONG2_DATA, EVENT_COUNT_2, BPM_2, SONG_FORMAT_RAW, "La Bamba", 37964, sizeof(SONG2_DATA) },         // Entry for Song 2
+  { SONG3_DATA, EVENT_COUNT_3, BPM_3, SONG_FORMAT_RAW, "Strobe Simple", 30000, sizeof(SONG3_DATA) },
+  { SONG4_DATA, EVENT_COUNT_4, BPM_4, SONG_FORMAT_RAW, "Strobe Refined", 44878, sizeof(SONG4_DATA) },
+  { SONG5_DATA, EVENT_COUNT_5, BPM_5, SONG_FORMAT_RAW, "Tetris A 1st Half", 28440, sizeof(SONG5_DATA) },
 };
 
+// --- Master Song Count ---
+// Derived from song_list, no manual update needed
+const uint16_t SONG_COUNT = sizeof(song_list) / sizeof(song_list[0]);
+
 //=============================================================================
 // END OF USER AREA
 //=============================================================================
 
+#endif // USE_SONG_BANK
+
 #endif  // SONG_DATA_H
\ No newline at end of file
@@ -0,0 +1,114 @@
+#ifndef SONG_FORMAT_H
+#define SONG_FORMAT_H
+
+#include <Arduino.h>
+#include <pgmspace.h>  // For PROGMEM
+
+// --- Event Layout ---
+// Each event is 6 bytes: delta_hi, delta_lo, event_type, note, velocity, channel.
+// event_type low nibble = type, high nibble = pre-allocated voice + 1 (0 = search at runtime).
+const uint8_t SONG_BYTES_PER_EVENT = 6;
+const uint8_t SONG_EVENT_TYPE_MASK = 0x0F;
+const uint8_t SONG_EVENT_VOICE_SHIFT = 4;
+
+// --- Event Types (low nibble of event_type) ---
+const uint8_t SONG_EVENT_NOTE_OFF = 0;
+const uint8_t SONG_EVENT_NOTE_ON = 1;
+const uint8_t SONG_EVENT_LONG_DELTA = 2; // No-op; bytes 3-4 hold the upper 16 bits of its delta
+// Zero-time instruction: play the 'length' events starting 'distance' events back, 'count' times.
+// Bytes 0-1 = length, 3-4 = distance, 5 = count. Raw songs only (the LZ stream cannot seek).
+const uint8_t SONG_EVENT_REPEAT = 3;
+// Tempo change: bytes 3-5 = microseconds per quarter note (24-bit, as in a MIDI set_tempo)
+const uint8_t SONG_EVENT_TEMPO = 4;
+// MIDI control change: byte 3 = controller, 4 = value, 5 = channel (0-15).
+// The player acts on SONG_MIDI_CC_PAN and ignores other controllers.
+const uint8_t SONG_EVENT_CONTROL = 5;
+const uint8_t SONG_MIDI_CC_PAN = 10;
+const uint8_t SONG_MIDI_CHANNELS = 16;
+
+// --- Song Data Formats ---
+const uint8_t SONG_FORMAT_RAW = 0;  // 6 bytes per event, as printed by myMidiParse2.py
+const uint8_t SONG_FORMAT_LZ = 1;   // LZ-compressed events (myMidiParse2.py --compress)
+
+// --- Song Information Structure ---
+// Holds metadata for one song stored in PROGMEM. Every field has to be given, so
+// an entry cannot leave out data_size; MidiPlayer::loadSong rejects a size of 0.
+struct SongInfo {
+  const uint8_t* midi_data_ptr;  // Pointer to the PROGMEM data array
+  uint32_t event_count;          // Number of (decompressed) events
+  float bpm;
+  uint8_t format;                // SONG_FORMAT_*
+  const char* title;
+  uint32_t duration_ms;          // Playing time at the song's tempo (0 = unknown)
+  uint32_t data_size;            // Bytes in the data array, checked against event_count at load
+
+  constexpr SongInfo(const uint8_t* data, uint32_t events, float song_bpm, uint8_t song_format,
+                     const char* song_title, uint32_t duration, uint32_t size) :
+    midi_data_ptr(data), event_count(events), bpm(song_bpm), format(song_format), title(song_title),
+    duration_ms(duration), data_size(size) {}
+};
+
+// --- Compile-Time Validation ---
+// Song arrays are declared constexpr so these checks run inside static_assert.
+// Written as single-return recursive functions for C++11, splitting the range
+// in half so the recursion depth stays logarithmic in the song length.
+// MidiPlayer::loadSong runs songEventValid at load time on data the compiler
+// cannot see (LZ streams, --bin banks).
+
+constexpr uint8_t songEventByte(const uint8_t* data, uint32_t index, uint8_t offset) {
+  return data[index * SONG_BYTES_PER_EVENT + offset];
+}
+
+constexpr uint16_t songEventWord(const uint8_t* data, uint32_t index, uint8_t offset) {
+  return (uint16_t)((songEventByte(data, index, offset) << 8) | songEventByte(data, index, offset + 1));
+}
+
+constexpr bool songRepeatValid(const uint8_t* data, uint32_t index) {
+  return songEventWord(data, index, 0) > 0                                  // length
+      && songEventByte(data, index, 5) > 0                                  // count
+      && songEventWord(data, index, 3) >= songEventWord(data, index, 0)     // range ends before the instruction
+      && songEventWord(data, index, 3) <= index;                            // range starts inside the song
+}
+
+constexpr bool songTempoValid(const uint8_t* data, uint32_t index) {
+  return (songEventByte(data, index, 3) | songEventByte(data, index, 4) | songEventByte(data, index, 5)) != 0;
+}
+
+constexpr bool songControlValid(const uint8_t* data, uint32_t index) {
+  return songEventByte(data, index, 3) < 128 && songEventByte(data, index, 4) < 128
+      && songEventByte(data, index, 5) < SONG_MIDI_CHANNELS;
+}
+
+constexpr bool songEventValid(const uint8_t* data, uint32_t index) {
+  return ((songEventByte(data, index, 2) & SONG_EVENT_TYPE_MASK) == SONG_EVENT_NOTE_OFF ||
+          (songEventByte(data, index, 2) & SONG_EVENT_TYPE_MASK) == SONG_EVENT_NOTE_ON)
+             ? (songEventByte(data, index, 3) < 128 && songEventByte(data, index, 4) < 128)
+         : (songEventByte(data, index, 2) & SONG_EVENT_TYPE_MASK) == SONG_EVENT_LONG_DELTA
+             ? true
+         : (songEventByte(data, index, 2) & SONG_EVENT_TYPE_MASK) == SONG_EVENT_REPEAT
+             ? songRepeatValid(data, index)
+         : (songEventByte(data, index, 2) & SONG_EVENT_TYPE_MASK) == SONG_EVENT_TEMPO
+             ? songTempoValid(data, index)
+         : (songEventByte(data, index, 2) & SONG_EVENT_TYPE_MASK) == SONG_EVENT_CONTROL
+             ? songControlValid(data, index)
+             : false; // Unknown event type
+}
+
+constexpr bool songEventsValid(const uint8_t* data, uint32_t first, uint32_t last) {
+  return (last <= first)
+             ? false // Empty song
+         : (last - first == 1)
+             ? songEventValid(data, first)
+             : songEventsValid(data, first, first + (last - first) / 2) &&
+               songEventsValid(data, first + (last - first) / 2, last);
+}
+
+// Number of events in a raw song array, derived from its size
+#define SONG_EVENT_COUNT(data) ((uint32_t)(sizeof(data) / SONG_BYTES_PER_EVENT))
+
+// Reject malformed raw song data at build time
+#define SONG_VALIDATE(data) \
+  static_assert(sizeof(data) % SONG_BYTES_PER_EVENT == 0, #data ": byte length is not a multiple of the event size"); \
+  static_assert(songEventsValid(data, 0, SONG_EVENT_COUNT(data)), #data ": event type, note, velocity, repeat, tempo or control out of range")
+
+#endif // SONG_FORMAT_H
@@ -0,0 +1,34 @@
+#include "SongRenderer.h"
+
+// First sample at or after song time ms
+static uint64_t sampleForMillis(unsigned long ms, uint32_t sample_rate) {
+    return ((uint64_t)ms * sample_rate + 999) / 1000;
+}
+
+uint32_t SongRenderer::render(Synthesizer& synth, MidiPlayer& player, SampleSink sink, void* context,
+                              int channels) {
+    static int16_t block[BLOCK_SAMPLES * 2];
+    uint64_t sample = 0;
+    uint32_t sample_rate = (uint32_t)lroundf(synth.sampleRate());
+
+    player.startAt(0);
+    while (true) {
+        // Apply every event that is due at this sample
+        while (player.isPlaying() && sample >= sampleForMillis(player.nextEventTime(), sample_rate)) {
+            if (!player.step()) break;
+        }
+        if (!player.isPlaying()) break;
+
+        // Then render up to the next event
+        uint64_t remaining = sampleForMillis(player.nextEventTime(), sample_rate) - sample;
+        size_t count = remaining < BLOCK_SAMPLES ? (size_t)remaining : BLOCK_SAMPLES;
+        if (channels == 2) {
+            synth.renderBlockStereo(block, count);
+        } else {
+            synth.renderBlock(block, count);
+        }
+        if (sink) sink(block, count * (channels == 2 ? 2 : 1), context);
+        sample += count;
+    }
+    return (uint32_t)sample;
+}
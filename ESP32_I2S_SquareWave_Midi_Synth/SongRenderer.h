@@ -0,0 +1,28 @@
+#ifndef SONG_RENDERER_H
+#define SONG_RENDERER_H
+
+#include <Arduino.h>
+#include "Synthesizer.h"
+#include "MidiPlayer.h"
+
+// Offline song rendering: drives a MidiPlayer in song time and pulls samples from
+// a Synthesizer without I2S or an audio task (set up with initVoices()).
+//
+// Events are applied at the first sample at or after their millisecond, exactly
+// where the real-time player would apply them at best, and the synth is rendered
+// in blocks between events. The output is deterministic, so it can be hashed.
+class SongRenderer {
+public:
+    static const size_t BLOCK_SAMPLES = 256;
+
+    // Receives each rendered block: count samples, interleaved left, right when stereo
+    typedef void (*SampleSink)(const int16_t* samples, size_t count, void* context);
+
+    // Render a loaded song from start to its last event. synth must be an offline
+    // instance the player was initialized with. channels = 1 renders mono
+    // (renderBlock), 2 panned stereo (renderBlockStereo). Returns the number of frames.
+    static uint32_t render(Synthesizer& synth, MidiPlayer& player, SampleSink sink, void* context,
+                           int channels = 1);
+};
+
+#endif // SONG_RENDERER_H
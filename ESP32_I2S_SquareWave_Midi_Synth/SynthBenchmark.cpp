@@ -0,0 +1,379 @@
+#include "SynthBenchmark.h"
+#include "MidiPlayer.h"
+#include "LzStreamDecoder.h"
+#include "JsonPrint.h"
+#include "SynthTrace.h"
+#include <pgmspace.h> // For PROGMEM read functions
+
+static const size_t RENDER_BLOCK_SAMPLES = 256;
+static const int RENDER_BLOCKS = 64;
+static const int NOTE_ITERATIONS = 1000;
+static const int LIVE_NOTE_ITERATIONS = 100;
+static const int LIVE_NOTE_NUMBER = 127; // Highest note at minimum velocity: barely audible blip
+static const int BLOCK_PATH_BLOCKS = 256;
+static const int BLOCK_PATH_ROUNDS = 5;  // Fastest round counts: the difference between builds is small
+
+// Notes and pans for busy-mix voice v: notes stay in 48-105 and pans spread left to
+// right however many voices the build has; the channel carries the pan
+static int benchNote(int v) { return 48 + (v * 3) % 60; }
+static int benchChannel(int v) { return v % SYNTH_MIDI_CHANNEL_COUNT; }
+static int benchPan(int v) {
+    int channels = SYNTH_MAX_VOICES < SYNTH_MIDI_CHANNEL_COUNT ? SYNTH_MAX_VOICES : SYNTH_MIDI_CHANNEL_COUNT;
+    return channels > 1 ? benchChannel(v) * 127 / (channels - 1) : SYNTH_PAN_CENTER;
+}
+
+// Cycle counts are converted once at the end so the timed loops stay tight
+static uint32_t cyclesToNs(uint64_t cycles, uint32_t count) {
+    if (count == 0) return 0;
+    return (uint32_t)(cycles * 1000 / ESP.getCpuFreqMHz() / count);
+}
+
+static void benchmarkRender(Synthesizer& synth) {
+    static int16_t block[RENDER_BLOCK_SAMPLES * 2];
+    uint32_t ns_per_sample[SYNTH_MAX_VOICES];
+    uint32_t ns_per_stereo_frame[SYNTH_MAX_VOICES];
+
+    for (int voices = 1; voices <= SYNTH_MAX_VOICES; ++voices) {
+        synth.initVoices();
+        synth.resetControllers();
+        for (int v = 0; v < voices; ++v) {
+            synth.setChannelPan(benchChannel(v), benchPan(v));
+            synth.startNoteOnVoice(v, benchNote(v), 100, benchChannel(v));
+        }
+        synth.renderBlock(block, RENDER_BLOCK_SAMPLES); // Warm caches
+
+        uint32_t start = ESP.getCycleCount();
+        for (int b = 0; b < RENDER_BLOCKS; ++b) {
+            synth.renderBlock(block, RENDER_BLOCK_SAMPLES);
+        }
+        uint32_t cycles = ESP.getCycleCount() - start;
+        ns_per_sample[voices - 1] = cyclesToNs(cycles, RENDER_BLOCKS * RENDER_BLOCK_SAMPLES);
+
+        // Same voices mixed into panned stereo frames
+        synth.renderBlockStereo(block, RENDER_BLOCK_SAMPLES);
+        start = ESP.getCycleCount();
+        for (int b = 0; b < RENDER_BLOCKS; ++b) {
+            synth.renderBlockStereo(block, RENDER_BLOCK_SAMPLES);
+        }
+        cycles = ESP.getCycleCount() - start;
+        ns_per_stereo_frame[voices - 1] = cyclesToNs(cycles, RENDER_BLOCKS * RENDER_BLOCK_SAMPLES);
+    }
+    synth.initVoices();
+    synth.resetControllers();
+
+    Serial.printf("BENCH {\"bench\":\"render\",\"cpu_mhz\":%lu,\"sample_rate\":%d,\"block\":%u,\"ns_per_sample\":[",
+                  (unsigned long)ESP.getCpuFreqMHz(), SYNTH_SAMPLE_RATE, (unsigned)RENDER_BLOCK_SAMPLES);
+    for (int v = 0; v < SYNTH_MAX_VOICES; ++v) {
+        Serial.printf(v ? ",%lu" : "%lu", (unsigned long)ns_per_sample[v]); // Index = active voices - 1
+    }
+    Serial.print("],\"ns_per_stereo_frame\":[");
+    for (int v = 0; v < SYNTH_MAX_VOICES; ++v) {
+        Serial.printf(v ? ",%lu" : "%lu", (unsigned long)ns_per_stereo_frame[v]);
+    }
+    Serial.println("]}");
+}
+
+static void benchmarkOversampling(Synthesizer& synth) {
+    static const int FACTORS[] = { 1, 2, SYNTH_MAX_OVERSAMPLING };
+    static const int FACTOR_COUNT = sizeof(FACTORS) / sizeof(FACTORS[0]);
+    static int16_t block[RENDER_BLOCK_SAMPLES * 2];
+    uint32_t ns_per_sample[FACTOR_COUNT];
+    uint32_t ns_per_stereo_frame[FACTOR_COUNT];
+
+    for (int f = 0; f < FACTOR_COUNT; ++f) {
+        synth.setOversampling(FACTORS[f]);
+        synth.initVoices();
+        synth.resetControllers();
+        for (int v = 0; v < SYNTH_MAX_VOICES; ++v) { // Worst case: every voice playing
+            synth.setChannelPan(benchChannel(v), benchPan(v));
+            synth.startNoteOnVoice(v, benchNote(v), 100, benchChannel(v));
+        }
+        synth.renderBlock(block, RENDER_BLOCK_SAMPLES); // Warm caches
+
+        uint32_t start = ESP.getCycleCount();
+        for (int b = 0; b < RENDER_BLOCKS; ++b) {
+            synth.renderBlock(block, RENDER_BLOCK_SAMPLES);
+        }
+        uint32_t cycles = ESP.getCycleCount() - start;
+        ns_per_sample[f] = cyclesToNs(cycles, RENDER_BLOCKS * RENDER_BLOCK_SAMPLES);
+
+        synth.renderBlockStereo(block, RENDER_BLOCK_SAMPLES);
+        start = ESP.getCycleCount();
+        for (int b = 0; b < RENDER_BLOCKS; ++b) {
+            synth.renderBlockStereo(block, RENDER_BLOCK_SAMPLES);
+        }
+        cycles = ESP.getCycleCount() - start;
+        ns_per_stereo_frame[f] = cyclesToNs(cycles, RENDER_BLOCKS * RENDER_BLOCK_SAMPLES);
+    }
+    synth.setOversampling(1);
+    synth.initVoices();
+    synth.resetControllers();
+
+    Serial.printf("BENCH {\"bench\":\"oversample\",\"voices\":%d,\"factors\":[", SYNTH_MAX_VOICES);
+    for (int f = 0; f < FACTOR_COUNT; ++f) {
+        Serial.printf(f ? ",%d" : "%d", FACTORS[f]);
+    }
+    Serial.print("],\"ns_per_sample\":[");
+    for (int f = 0; f < FACTOR_COUNT; ++f) {
+        Serial.printf(f ? ",%lu" : "%lu", (unsigned long)ns_per_sample[f]); // Per output sample
+    }
+    Serial.print("],\"ns_per_stereo_frame\":[");
+    for (int f = 0; f < FACTOR_COUNT; ++f) {
+        Serial.printf(f ? ",%lu" : "%lu", (unsigned long)ns_per_stereo_frame[f]);
+    }
+    Serial.println("]}");
+}
+
+static void benchmarkMasterChain(Synthesizer& synth) {
+    static int16_t block[SYNTH_RENDER_BLOCK_SAMPLES * SYNTH_OUTPUT_CHANNELS];
+    MasterChain chain;
+    MasterChainConfig config;
+    config.order[0] = MASTER_DC_BLOCKER;
+    config.order[1] = MASTER_TONE;
+    config.order[2] = MASTER_ECHO;
+    if (!chain.begin(config, synth.sampleRate(), SYNTH_OUTPUT_CHANNELS)) {
+        Serial.println("Benchmark Error: Failed to set up the master chain.");
+        return;
+    }
+
+    // A busy mix: every voice playing, so no stage sees silence
+    synth.initVoices();
+    for (int v = 0; v < SYNTH_MAX_VOICES; ++v) {
+        synth.startNoteOnVoice(v, benchNote(v), 100, benchChannel(v));
+    }
+    uint64_t stage_totals[MASTER_STAGE_COUNT] = {};
+    uint32_t stage_cycles[MASTER_STAGE_COUNT];
+    for (int b = 0; b < RENDER_BLOCKS; ++b) {
+#if SYNTH_MONO_OUTPUT
+        synth.renderBlock(block, SYNTH_RENDER_BLOCK_SAMPLES);
+#else
+        synth.renderBlockStereo(block, SYNTH_RENDER_BLOCK_SAMPLES);
+#endif
+        chain.process(block, SYNTH_RENDER_BLOCK_SAMPLES, stage_cycles);
+        for (int s = 0; s < MASTER_STAGE_COUNT; ++s) {
+            stage_totals[s] += stage_cycles[s];
+        }
+    }
+    synth.initVoices();
+
+    Serial.printf("BENCH {\"bench\":\"master\",\"block_frames\":%d,\"channels\":%d,\"cycles_per_block\":{",
+                  SYNTH_RENDER_BLOCK_SAMPLES, SYNTH_OUTPUT_CHANNELS);
+    for (int s = 0; s < MASTER_STAGE_COUNT; ++s) {
+        Serial.printf(s ? ",\"%s\":%lu" : "\"%s\":%lu", MasterChain::stageName((MasterStage)s),
+                      (unsigned long)(stage_totals[s] / RENDER_BLOCKS));
+    }
+    Serial.println("}}");
+}
+
+static void benchmarkNotes(Synthesizer& synth, Synthesizer& live_synth) {
+    uint64_t on_cycles = 0, off_cycles = 0, on_voice_cycles = 0, off_voice_cycles = 0;
+    for (int i = 0; i < NOTE_ITERATIONS; ++i) {
+        int note = 36 + i % 48;
+        uint32_t t0 = ESP.getCycleCount();
+        synth.startNote(note, 100);
+        uint32_t t1 = ESP.getCycleCount();
+        synth.stopNote(note);
+        uint32_t t2 = ESP.getCycleCount();
+        synth.startNoteOnVoice(i % SYNTH_MAX_VOICES, note, 100);
+        uint32_t t3 = ESP.getCycleCount();
+        synth.stopNoteOnVoice(i % SYNTH_MAX_VOICES, note);
+        uint32_t t4 = ESP.getCycleCount();
+        on_cycles += t1 - t0;
+        off_cycles += t2 - t1;
+        on_voice_cycles += t3 - t2;
+        off_voice_cycles += t4 - t3;
+    }
+
+    // Same calls against the running audio task: includes waiting for the voices mutex
+    uint64_t live_cycles = 0;
+    uint32_t live_max_cycles = 0;
+    for (int i = 0; i < LIVE_NOTE_ITERATIONS; ++i) {
+        uint32_t t0 = ESP.getCycleCount();
+        live_synth.startNote(LIVE_NOTE_NUMBER, 1);
+        live_synth.stopNote(LIVE_NOTE_NUMBER);
+        uint32_t cycles = ESP.getCycleCount() - t0;
+        live_cycles += cycles;
+        if (cycles > live_max_cycles) live_max_cycles = cycles;
+        delay(1); // Land at different points of the audio task's loop
+    }
+
+    Serial.printf("BENCH {\"bench\":\"note\",\"on_ns\":%lu,\"off_ns\":%lu,\"on_voice_ns\":%lu,\"off_voice_ns\":%lu,"
+                  "\"live_on_off_ns\":%lu,\"live_on_off_max_ns\":%lu}\n",
+                  (unsigned long)cyclesToNs(on_cycles, NOTE_ITERATIONS),
+                  (unsigned long)cyclesToNs(off_cycles, NOTE_ITERATIONS),
+                  (unsigned long)cyclesToNs(on_voice_cycles, NOTE_ITERATIONS),
+                  (unsigned long)cyclesToNs(off_voice_cycles, NOTE_ITERATIONS),
+                  (unsigned long)cyclesToNs(live_cycles, LIVE_NOTE_ITERATIONS),
+                  (unsigned long)cyclesToNs(live_max_cycles, 1));
+}
+
+static void benchmarkSong(Synthesizer& synth, const SongInfo* song, BenchmarkClockAdvance advance_clock) {
+    static MidiPlayer player;
+    static LzStreamDecoder lz_decoder;
+    uint8_t event[SONG_BYTES_PER_EVENT];
+
+    const uint8_t* data = (const uint8_t*)pgm_read_ptr_near(&song->midi_data_ptr);
+    uint32_t event_count = pgm_read_dword_near(&song->event_count);
+    uint8_t format = pgm_read_byte_near(&song->format);
+    const char* title = (const char*)pgm_read_ptr_near(&song->title);
+
+    // Decode only: what fetching each stored event costs before any dispatch
+    uint32_t start = ESP.getCycleCount();
+    if (format == SONG_FORMAT_LZ) {
+        lz_decoder.begin(data);
+        for (uint32_t i = 0; i < event_count; ++i) {
+            lz_decoder.read(event, SONG_BYTES_PER_EVENT);
+        }
+    } else {
+        for (uint32_t i = 0; i < event_count; ++i) {
+            memcpy_P(event, data + i * SONG_BYTES_PER_EVENT, SONG_BYTES_PER_EVENT);
+        }
+    }
+    uint32_t decode_cycles = ESP.getCycleCount() - start;
+
+    // Whole player path, with repeats expanded and notes sent to the offline synth
+    uint32_t steps = 0;
+    uint64_t step_cycles = 0;
+    synth.initVoices();
+    player.init(synth);
+    if (player.loadSong(song)) {
+        player.start();
+        start = ESP.getCycleCount();
+        while (player.step()) {
+            steps++;
+        }
+        step_cycles = ESP.getCycleCount() - start;
+    }
+
+    // update() as loop() calls it, with the clock moved to each event's due time
+    // between the timed calls, so every call dispatches exactly one event
+    uint32_t updates = 0;
+    uint64_t update_cycles = 0;
+    if (advance_clock != nullptr) {
+        synth.initVoices();
+        player.init(synth);
+        if (player.loadSong(song)) {
+            player.start();
+            while (true) {
+                long wait_ms = (long)(player.nextEventTime() - millis());
+                if (wait_ms > 0) advance_clock((unsigned long)wait_ms);
+                start = ESP.getCycleCount();
+                bool playing = player.update();
+                uint32_t cycles = ESP.getCycleCount() - start;
+                if (!playing) break; // The last call only prints the latency summary
+                update_cycles += cycles;
+                updates++;
+            }
+        }
+    }
+
+    Serial.print("BENCH {\"bench\":\"song\",\"title\":");
+    printJsonString(title);
+    Serial.printf(",\"format\":\"%s\",\"events\":%lu,\"steps\":%lu,\"decode_ns_per_event\":%lu,\"step_ns_per_event\":%lu",
+                  format == SONG_FORMAT_LZ ? "lz" : "raw", (unsigned long)event_count, (unsigned long)steps,
+                  (unsigned long)cyclesToNs(decode_cycles, event_count),
+                  (unsigned long)cyclesToNs(step_cycles, steps));
+    if (advance_clock != nullptr) {
+        Serial.printf(",\"updates\":%lu,\"update_ns_per_event\":%lu", (unsigned long)updates,
+                      (unsigned long)cyclesToNs(update_cycles, updates));
+    }
+    Serial.println("}");
+}
+
+// The audio tasks' per-block path with the same SynthTrace points as
+// Synthesizer::renderTaskRunner/outputTaskRunner: a free slot from the ring, the
+// block mixed in the output layout, and its handoff through the ready queue and
+// back. Both sides run on this task, so the queues never wait and only the work
+// is timed (no I2S write, no master chain). Returns ns per block.
+static uint32_t benchmarkBlockPath(Synthesizer& synth) {
+    static int16_t block[SYNTH_RENDER_BLOCK_SAMPLES * SYNTH_OUTPUT_CHANNELS];
+    QueueHandle_t free_slots = xQueueCreate(SYNTH_MAX_RENDER_AHEAD, sizeof(uint8_t));
+    QueueHandle_t ready_slots = xQueueCreate(SYNTH_MAX_RENDER_AHEAD, sizeof(uint8_t));
+    if (free_slots == NULL || ready_slots == NULL) {
+        if (free_slots) vQueueDelete(free_slots);
+        if (ready_slots) vQueueDelete(ready_slots);
+        Serial.println("Benchmark Error: Failed to create the block path queues.");
+        return 0;
+    }
+    for (uint8_t slot = 0; slot < 2; ++slot) xQueueSend(free_slots, &slot, 0);
+    synth.initVoices();
+    synth.resetControllers();
+    for (int v = 0; v < SYNTH_MAX_VOICES; ++v) {
+        synth.setChannelPan(benchChannel(v), benchPan(v));
+        synth.startNoteOnVoice(v, benchNote(v), 100, benchChannel(v));
+    }
+
+    uint32_t best_cycles = UINT32_MAX;
+    for (int round = 0; round < BLOCK_PATH_ROUNDS; ++round) {
+        uint32_t start = ESP.getCycleCount();
+        for (int b = 0; b < BLOCK_PATH_BLOCKS; ++b) {
+            uint8_t slot;
+            SYNTH_TRACE_BEGIN(TRACE_FREE_SLOT_WAIT, 0);
+            xQueueReceive(free_slots, &slot, 0);
+            SYNTH_TRACE_END(TRACE_FREE_SLOT_WAIT, slot);
+            SYNTH_TRACE_BEGIN(TRACE_RENDER_BLOCK, slot);
+#if SYNTH_MONO_OUTPUT
+            synth.renderBlock(block, SYNTH_RENDER_BLOCK_SAMPLES);
+#else
+            synth.renderBlockStereo(block, SYNTH_RENDER_BLOCK_SAMPLES);
+#endif
+            SYNTH_TRACE_END(TRACE_RENDER_BLOCK, slot);
+            xQueueSend(ready_slots, &slot, 0);
+            xQueueReceive(ready_slots, &slot, 0);
+            SYNTH_TRACE_BEGIN(TRACE_I2S_WRITE, slot);
+            SYNTH_TRACE_END(TRACE_I2S_WRITE, slot);
+            xQueueSend(free_slots, &slot, 0);
+        }
+        uint32_t cycles = ESP.getCycleCount() - start;
+        if (cycles < best_cycles) best_cycles = cycles;
+    }
+    vQueueDelete(free_slots);
+    vQueueDelete(ready_slots);
+    synth.initVoices();
+    synth.resetControllers();
+
+    uint32_t ns_per_block = cyclesToNs(best_cycles, BLOCK_PATH_BLOCKS);
+    uint32_t budget_ns = (uint32_t)((uint64_t)SYNTH_RENDER_BLOCK_SAMPLES * 1000000000ULL / SYNTH_SAMPLE_RATE);
+    Serial.printf("BENCH {\"bench\":\"block_path\",\"trace\":%d,\"voices\":%d,\"channels\":%d,\"ns_per_block\":%lu,"
+                  "\"budget_ns\":%lu,\"budget_percent\":%.2f}\n", SYNTH_TRACE, SYNTH_MAX_VOICES, SYNTH_OUTPUT_CHANNELS,
+                  (unsigned long)ns_per_block, (unsigned long)budget_ns, 100.0 * ns_per_block / budget_ns);
+    return ns_per_block;
+}
+
+static Synthesizer offline_synth; // No I2S, no audio task
+
+uint32_t runBlockPathBenchmark() {
+    if (!offline_synth.initVoices()) {
+        Serial.println("Benchmark Error: Failed to set up the offline synthesizer.");
+        return 0;
+    }
+    return benchmarkBlockPath(offline_synth);
+}
+
+void runSongBenchmarks(const SongInfo* songs, uint16_t song_count, BenchmarkClockAdvance advance_clock) {
+    if (!offline_synth.initVoices()) {
+        Serial.println("Benchmark Error: Failed to set up the offline synthesizer.");
+        return;
+    }
+    for (uint16_t i = 0; i < song_count; ++i) {
+        benchmarkSong(offline_synth, &songs[i], advance_clock);
+    }
+}
+
+void runSynthBenchmarks(Synthesizer& live_synth, const SongInfo* songs, uint16_t song_count,
+                        BenchmarkClockAdvance advance_clock) {
+    Synthesizer& synth = offline_synth;
+    if (!synth.initVoices()) {
+        Serial.println("Benchmark Error: Failed to set up the offline synthesizer.");
+        return;
+    }
+
+    Serial.println("Running benchmarks...");
+    benchmarkRender(synth);
+    benchmarkOversampling(synth);
+    benchmarkMasterChain(synth);
+    benchmarkNotes(synth, live_synth);
+    benchmarkBlockPath(synth);
+    runSongBenchmarks(songs, song_count, advance_clock);
+    Serial.println("Benchmarks complete.");
+}
@@ -0,0 +1,46 @@
+#ifndef SYNTH_BENCHMARK_H
+#define SYNTH_BENCHMARK_H
+
+#include <Arduino.h>
+#include "Synthesizer.h"
+#include "SongFormat.h"
+
+// On-device benchmarks for the synth and player hot paths.
+//
+// Each result is one line of JSON over Serial, prefixed with "BENCH ", so results
+// can be grepped out of a serial log and compared between changes:
+//   "render" : ns per mixed mono sample and per panned stereo frame, for
+//              1..SYNTH_MAX_VOICES active voices
+//   "oversample" : ns per output sample and per stereo frame with every voice
+//                  playing, at 1x, 2x and 4x (voice rendering + decimation)
+//   "master" : cycles per render block of each master chain stage (DC blocker,
+//              tone, echo) on a busy mix, in the output's channel layout
+//   "note"   : cost of the note calls on an idle synth, and with the audio task
+//              of live_synth contending for the voices mutex
+//   "block_path" : ns per render block through the audio tasks' path (ring slot,
+//              renderBlock/renderBlockStereo, queue handoff) with every voice
+//              playing, and that as a percentage of the block's real-time budget.
+//              Compare a SYNTH_TRACE=1 build's line with a normal build's for
+//              the cost of the trace points.
+//   "song"   : one line per song, event decode cost (memcpy_P or LzStreamDecoder)
+//              and MidiPlayer::step() cost per event (decode + dispatch). With
+//              advance_clock, also MidiPlayer::update() per event: step() plus
+//              the clock reads and the latency recording. steps above events
+//              means the song has repeat records (expanded by the player).
+// Rendering and song playback run on a separate offline Synthesizer, so the
+// running audio task is undisturbed apart from the live note measurement.
+//
+// advance_clock moves millis()/micros() forward by ms where the clock can be
+// simulated (the host). update() waits for real time otherwise, so without it
+// (on the device) the update figure is left out.
+typedef void (*BenchmarkClockAdvance)(unsigned long ms);
+void runSynthBenchmarks(Synthesizer& live_synth, const SongInfo* songs, uint16_t song_count,
+                        BenchmarkClockAdvance advance_clock = nullptr);
+
+// Only the "song" lines, for another song list (e.g. an LZ-compressed bank)
+void runSongBenchmarks(const SongInfo* songs, uint16_t song_count, BenchmarkClockAdvance advance_clock = nullptr);
+
+// Only the "block_path" line; returns its ns per block (0 on failure)
+uint32_t runBlockPathBenchmark();
+
+#endif // SYNTH_BENCHMARK_H
@@ -0,0 +1,59 @@
+#include "SynthTrace.h"
+
+#if SYNTH_TRACE
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+SynthTrace synthTrace;
+
+static const char* traceName(uint8_t id) {
+    switch (id) {
+        case TRACE_RENDER_BLOCK: return "render_block";
+        case TRACE_I2S_WRITE: return "i2s_write";
+        case TRACE_MUTEX_WAIT: return "mutex_wait";
+        case TRACE_NOTE_ON: return "note_on";
+        case TRACE_NOTE_OFF: return "note_off";
+        case TRACE_EVENT_DISPATCH: return "event_dispatch";
+        case TRACE_FREE_SLOT_WAIT: return "free_slot_wait";
+        case TRACE_READY_SLOT_WAIT: return "ready_slot_wait";
+        default: return "unknown";
+    }
+}
+
+SynthTrace::SynthTrace() :
+    next_entry(0),
+    paused(false)
+{}
+
+void SynthTrace::record(Phase phase, TraceId id, uint16_t arg) {
+    if (paused.load(std::memory_order_relaxed)) return;
+    Entry& entry = ring[next_entry.fetch_add(1, std::memory_order_relaxed) & (RING_SIZE - 1)];
+    entry.time_us = micros();
+    entry.task = (uint32_t)(uintptr_t)xTaskGetCurrentTaskHandle();
+    entry.phase = phase;
+    entry.id = id;
+    entry.core = (uint8_t)xPortGetCoreID();
+    entry.arg = arg;
+}
+
+void SynthTrace::dump() {
+    paused.store(true, std::memory_order_relaxed);
+    delay(2); // Let writers that already passed the check finish their entry
+
+    uint32_t written = next_entry.load(std::memory_order_relaxed);
+    uint32_t count = written < RING_SIZE ? written : RING_SIZE;
+    Serial.printf("TRACE_DUMP %lu\n", (unsigned long)count);
+    for (uint32_t i = written - count; i != written; ++i) {
+        const Entry& entry = ring[i & (RING_SIZE - 1)];
+        // T,time_us,task,core,phase,name,arg
+        Serial.printf("T,%lu,%08lx,%u,%c,%s,%u\n", (unsigned long)entry.time_us, (unsigned long)entry.task,
+                      entry.core, entry.phase, traceName(entry.id), entry.arg);
+    }
+    Serial.println("TRACE_DUMP_END");
+
+    next_entry.store(0, std::memory_order_relaxed);
+    paused.store(false, std::memory_order_relaxed);
+}
+
+#endif // SYNTH_TRACE
@@ -0,0 +1,80 @@
+#ifndef SYNTH_TRACE_H
+#define SYNTH_TRACE_H
+
+#include <Arduino.h>
+
+// Set to 1 (here, or with -DSYNTH_TRACE=1) to record timing traces.
+// When 0 every trace macro compiles to nothing.
+#ifndef SYNTH_TRACE
+#define SYNTH_TRACE 0
+#endif
+
+// --- Trace Points ---
+enum TraceId : uint8_t {
+    TRACE_RENDER_BLOCK = 1, // Span: audio task mixing one block
+    TRACE_I2S_WRITE,        // Span: audio task waiting for DMA space
+    TRACE_MUTEX_WAIT,       // Span: waiting for voicesMutex (any task)
+    TRACE_NOTE_ON,          // Instant, arg = note
+    TRACE_NOTE_OFF,         // Instant, arg = note
+    TRACE_EVENT_DISPATCH,   // Span: MidiPlayer processing one event, arg = event type
+    TRACE_FREE_SLOT_WAIT,   // Span: render task waiting for a free ring slot, end arg = slot
+    TRACE_READY_SLOT_WAIT,  // Span: output task starved, waiting for a rendered block, end arg = slot
+};
+
+#if SYNTH_TRACE
+
+#include <atomic>
+
+// Flight recorder for timing glitches.
+//
+// record() stores a 16-byte entry (micros() timestamp, task, core, trace point,
+// argument) in a fixed RAM ring, overwriting the oldest entries: one atomic
+// increment and a few stores, safe from any task. dump() prints the ring over
+// Serial between "TRACE_DUMP" markers; _MyMidiParser/traceToChrome.py turns
+// a serial log into Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+class SynthTrace {
+public:
+    static const uint16_t RING_SIZE = 1024; // Power of two; 16 KB of RAM
+    enum Phase : uint8_t { PHASE_BEGIN = 'B', PHASE_END = 'E', PHASE_INSTANT = 'i' };
+
+    SynthTrace();
+
+    void record(Phase phase, TraceId id, uint16_t arg);
+
+    // Print all recorded entries, oldest first. Recording pauses meanwhile.
+    void dump();
+
+private:
+    struct Entry {
+        uint32_t time_us;
+        uint32_t task;  // Task handle, identifies the track in the trace viewer
+        uint8_t phase;
+        uint8_t id;
+        uint8_t core;
+        uint8_t reserved;
+        uint16_t arg;
+        uint16_t reserved2;
+    };
+
+    Entry ring[RING_SIZE];
+    std::atomic<uint32_t> next_entry;
+    std::atomic<bool> paused;
+};
+
+extern SynthTrace synthTrace;
+
+#define SYNTH_TRACE_BEGIN(id, arg) synthTrace.record(SynthTrace::PHASE_BEGIN, id, arg)
+#define SYNTH_TRACE_END(id, arg) synthTrace.record(SynthTrace::PHASE_END, id, arg)
+#define SYNTH_TRACE_INSTANT(id, arg) synthTrace.record(SynthTrace::PHASE_INSTANT, id, arg)
+#define SYNTH_TRACE_DUMP() synthTrace.dump()
+
+#else
+
+#define SYNTH_TRACE_BEGIN(id, arg) ((void)0)
+#define SYNTH_TRACE_END(id, arg) ((void)0)
+#define SYNTH_TRACE_INSTANT(id, arg) ((void)0)
+#define SYNTH_TRACE_DUMP() ((void)0)
+
+#endif // SYNTH_TRACE
+
+#endif // SYNTH_TRACE_H
@@ -1,23 +1,82 @@
                                                                    #include "Synthesizer.h"
 #include <Arduino.h> // For Serial, constrain, roundf, powf, etc.
 #include <cmath>     // For roundf, powf
+#include "DeferredLog.h" // Warnings from code holding voicesMutex
+#include "SynthTrace.h"  // Optional timing traces
+
+// Constant-power pan law in Q14, indexed by pan position 0 (hard left) to 126 (hard right):
+// round(16384 * sqrt(2) * cos(position / 126 * pi / 2)). The right gain is the same table
+// read backwards. Scaled by sqrt(2) so a centered voice keeps its mono level; hard panned
+// it peaks at 1.41 * SYNTH_MAX_NOTE_AMPLITUDE, still inside int16. CC10 0 and 1 are both
+// hard left, which puts 64 on the exact center.
+static const int PAN_LAW_POSITIONS = 127;
+static const uint16_t PAN_LAW_Q14[PAN_LAW_POSITIONS] = {
+    23170, 23169, 23163, 23154, 23142, 23125, 23106, 23082, 23055, 23025, 22991, 22953,
+    22912, 22867, 22818, 22767, 22711, 22652, 22590, 22524, 22454, 22381, 22304, 22224,
+    22141, 22054, 21964, 21870, 21773, 21673, 21569, 21462, 21351, 21237, 21120, 21000,
+    20876, 20749, 20619, 20485, 20349, 20209, 20066, 19920, 19771, 19619, 19464, 19306,
+    19144, 18980, 18813, 18643, 18470, 18294, 18115, 17934, 17750, 17563, 17373, 17180,
+    16985, 16787, 16587, 16384, 16178, 15970, 15760, 15547, 15332, 15114, 14894, 14671,
+    14447, 14220, 13990, 13759, 13526, 13290, 13052, 12813, 12571, 12327, 12082, 11834,
+    11585, 11334, 11081, 10827, 10571, 10313, 10053, 9792, 9530, 9266, 9000, 8733,
+    8465, 8196, 7925, 7653, 7379, 7105, 6830, 6553, 6276, 5997, 5717, 5437,
+    5156, 4874, 4591, 4308, 4024, 3739, 3453, 3167, 2881, 2594, 2307, 2019,
+    1732, 1443, 1155, 866, 578, 289, 0
+};
+
+// Advance one voice's square wave by a sample
+static inline void advanceSquareWave(VoiceState& voice) {
+    if (voice.timeAtLevelRemaining == 0) {
+        voice.currentOutput = (voice.currentOutput == voice.targetAmplitude)
+                                 ? -voice.targetAmplitude
+                                 : voice.targetAmplitude;
+        voice.timeAtLevelRemaining = voice.wavelength;
+    }
+    if(voice.timeAtLevelRemaining > 0) {
+       voice.timeAtLevelRemaining--;
+    }
+}
 
 // Constructor: Initialize basic members
 Synthesizer::Synthesizer() :
     i2s_port(I2S_NUM_0), // Or pass as parameter if needed
-    voicesMutex(NULL)
+    i2s_event_queue(NULL),
+    voicesMutex(NULL),
+    oversampling(1),
+    decimators{ { HalfBandDecimator(HalfBandDecimator::FILTER_SHORT), HalfBandDecimator(HalfBandDecimator::FILTER_SHARP) },
+                { HalfBandDecimator(HalfBandDecimator::FILTER_SHORT), HalfBandDecimator(HalfBandDecimator::FILTER_SHARP) } },
+    stats_sequence(0),
+    stats_reset_requested(false),
+    stats_budget_cycles(0),
+    stats_blocks(0),
+    stats_total_cycles(0),
+    stats_max_cycles(0),
+    stats_underruns(0),
+    stats_total_slack_us(0),
+    stats_min_slack_us(UINT32_MAX),
+    stats_starved(0),
+    last_block_start_us(0),
+    dma_latency_us(0),
+    render_ahead_blocks(SynthOutputConfig().render_ahead_blocks),
+    render_ring(NULL),
+    free_slots(NULL),
+    ready_slots(NULL)
 {
+    buildRateTables_unsafe((float)SYNTH_SAMPLE_RATE); // No other user yet
+    memset(channel_pan, SYNTH_PAN_CENTER, sizeof(channel_pan));
+    memset(stats_master_cycles, 0, sizeof(stats_master_cycles));
+
     // Initialize I2S Config Struct
     i2s_config = {
         .mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX),
         .sample_rate = SYNTH_SAMPLE_RATE,
         .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
-        .channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT,
+        .channel_format = SYNTH_MONO_OUTPUT ? I2S_CHANNEL_FMT_ONLY_LEFT : I2S_CHANNEL_FMT_RIGHT_LEFT,
         .communication_format = I2S_COMM_FORMAT_STAND_I2S,
         .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-        .dma_buf_count = 8,
-        .dma_buf_len = 1024, // Samples per buffer
-        .use_apll = false,
+        .dma_buf_count = 8,  // Rate, buffers and APLL are set from SynthOutputConfig in init()
+        .dma_buf_len = 1024, // Frames per buffer
+        .use_apll = true,
         .tx_desc_auto_clear = true,
         .fixed_mclk = I2S_PIN_NO_CHANGE
     };
@@ -32,33 +91,43 @@ Synthesizer::Synthesizer() :
 }
 
 // Initialize I2S, Mutex, Voices, and start Audio Task
-bool Synthesizer::init() {
+bool Synthesizer::init(const SynthOutputConfig& config) {
     Serial.println("Synthesizer initializing...");
 
-    // 1. Create Mutex
-    voicesMutex = xSemaphoreCreateMutex();
-    if (voicesMutex == NULL) {
-        Serial.println("Error: Failed to create voices mutex!");
+    if (config.dma_buf_count < SYNTH_DMA_BUF_COUNT_MIN || config.dma_buf_count > SYNTH_DMA_BUF_COUNT_MAX ||
+        config.dma_buf_len < SYNTH_DMA_BUF_LEN_MIN || config.dma_buf_len > SYNTH_DMA_BUF_LEN_MAX) {
+        Serial.printf("Error: DMA buffers %d x %d outside %d-%d x %d-%d frames.\n",
+                      config.dma_buf_count, config.dma_buf_len, SYNTH_DMA_BUF_COUNT_MIN, SYNTH_DMA_BUF_COUNT_MAX,
+                      SYNTH_DMA_BUF_LEN_MIN, SYNTH_DMA_BUF_LEN_MAX);
         return false;
     }
-    Serial.println("- Mutex created.");
-
-    // 2. Initialize Voices (safely using mutex)
-    if (xSemaphoreTake(voicesMutex, portMAX_DELAY) == pdTRUE) {
-        for (int i = 0; i < SYNTH_MAX_VOICES; ++i) {
-            voices[i].isActive = false;
-            // Reset other fields if desired
-        }
-        xSemaphoreGive(voicesMutex);
-        Serial.println("- Voices initialized.");
-    } else {
-         Serial.println("Error: Failed to take mutex for voice init!");
-         return false;
+    if (config.render_ahead_blocks < 1 || config.render_ahead_blocks > SYNTH_MAX_RENDER_AHEAD) {
+        Serial.printf("Error: Render-ahead depth %d outside 1-%d blocks.\n", config.render_ahead_blocks,
+                      SYNTH_MAX_RENDER_AHEAD);
+        return false;
+    }
+    if (!isSupportedSampleRate(config.sample_rate)) {
+        Serial.printf("Error: Unsupported sample rate %lu Hz.\n", (unsigned long)config.sample_rate);
+        return false;
+    }
+    if (!isSupportedOversampling(config.oversampling)) {
+        Serial.printf("Error: Unsupported oversampling factor %d (1, 2 or 4).\n", config.oversampling);
+        return false;
+    }
+    oversampling = config.oversampling; // Tables are built for it below, with the achieved rate
+    i2s_config.sample_rate = config.sample_rate;
+    i2s_config.use_apll = config.use_apll;
+    i2s_config.dma_buf_count = config.dma_buf_count;
+    i2s_config.dma_buf_len = config.dma_buf_len;
+
+    // 1.-2. Create Mutex and initialize Voices
+    if (!initVoices()) {
+        return false;
     }
 
     // 3. Configure I2S Driver
     esp_err_t err;
-    err = i2s_driver_install(i2s_port, &i2s_config, 0, NULL);
+    err = i2s_driver_install(i2s_port, &i2s_config, SYNTH_I2S_EVENT_QUEUE_LENGTH, &i2s_event_queue);
     if (err != ESP_OK) {
         Serial.printf("Error: Failed to install I2S driver: %s\n", esp_err_to_name(err));
         return false;
@@ -71,33 +140,151 @@ bool Synthesizer::init() {
     }
     Serial.println("- I2S driver configured.");
 
-    // 4. Start Audio Task
+    // The clock divides down from a fixed source, so the real rate can differ from the
+    // request (noticeably so without the APLL). Tune pitch and timing to what we got.
+    float achieved_rate = i2s_get_clk(i2s_port);
+    if (achieved_rate <= 0.0f) achieved_rate = (float)config.sample_rate;
+    setSampleRate(achieved_rate);
+    Serial.printf("- Sample rate: %lu Hz requested, %.2f Hz achieved%s.\n", (unsigned long)config.sample_rate,
+                  achieved_rate, config.use_apll ? " (APLL)" : "");
+    if (oversampling > 1) {
+        Serial.printf("- Oversampling: %dx, voices at %.0f Hz.\n", oversampling, achieved_rate * oversampling);
+    }
+#if SYNTH_MONO_OUTPUT
+    Serial.printf("- I2S DMA: %d x %d mono frames, %u bytes (%u saved over stereo).\n",
+                  i2s_config.dma_buf_count, i2s_config.dma_buf_len,
+                  (unsigned)dmaBufferBytes(), (unsigned)dmaBufferBytes());
+#else
+    Serial.printf("- I2S DMA: %d x %d stereo frames, %u bytes.\n",
+                  i2s_config.dma_buf_count, i2s_config.dma_buf_len, (unsigned)dmaBufferBytes());
+#endif
+    Serial.printf("- Output latency: up to %lu us.\n", (unsigned long)worstCaseLatencyMicros(config));
+    if (!master_chain.begin(config.master, sample_rate, SYNTH_OUTPUT_CHANNELS)) {
+        return false;
+    }
+
+    // CPU time one render block may take before the DMA runs dry
+    stats_budget_cycles = (uint32_t)((double)ESP.getCpuFreqMHz() * 1e6 * SYNTH_RENDER_BLOCK_SAMPLES / sample_rate);
+    // In steady state i2s_write keeps every DMA buffer full
+    dma_latency_us = (uint32_t)((double)i2s_config.dma_buf_count * i2s_config.dma_buf_len * 1e6 / sample_rate);
+
+    // 4. Render-ahead ring: every slot starts out free
+    render_ahead_blocks = config.render_ahead_blocks;
+    render_ring = (int16_t*)malloc(render_ahead_blocks * SYNTH_RENDER_BLOCK_SAMPLES * SYNTH_OUTPUT_CHANNELS * sizeof(int16_t));
+    free_slots = xQueueCreate(render_ahead_blocks, sizeof(uint8_t));
+    ready_slots = xQueueCreate(render_ahead_blocks, sizeof(uint8_t));
+    if (render_ring == NULL || free_slots == NULL || ready_slots == NULL) {
+        Serial.println("Error: Failed to allocate the render-ahead ring!");
+        return false;
+    }
+    for (uint8_t slot = 0; slot < render_ahead_blocks; ++slot) {
+        xQueueSend(free_slots, &slot, 0);
+    }
+    Serial.printf("- Render-ahead ring: %d blocks of %d frames.\n", render_ahead_blocks, SYNTH_RENDER_BLOCK_SAMPLES);
+
+    // 5. Start Audio Tasks. Output outranks render so a finished block goes out at once;
+    // it spends most of its time blocked in i2s_write, which leaves the core to rendering.
     BaseType_t task_created = xTaskCreatePinnedToCore(
-        audioTaskWrapper,   // Static wrapper function
-        "SynthAudioTask",   // Task name
-        8192,               // Stack size (increase if needed)
+        outputTaskWrapper,  // Static wrapper function
+        "SynthOutputTask",  // Task name
+        4096,               // Stack size (increase if needed)
         this,               // Pass instance pointer as parameter
         configMAX_PRIORITIES - 1, // High priority
         NULL,               // Task handle (optional)
         1                   // Core ID (0 or 1)
     );
+    if (task_created == pdPASS) {
+        task_created = xTaskCreatePinnedToCore(renderTaskWrapper, "SynthRenderTask", 8192, this,
+                                               configMAX_PRIORITIES - 2, NULL, 1);
+    }
 
     if (task_created != pdPASS) {
-         Serial.println("Error: Failed to create Audio Task!");
+         Serial.println("Error: Failed to create Audio Tasks!");
          // Consider cleanup (mutex deletion, i2s uninstall)
          return false;
     }
-    Serial.println("- Audio task created on Core 1.");
+    Serial.println("- Render and output tasks created on Core 1.");
 
     Serial.println("Synthesizer initialization complete.");
     return true;
 }
 
 
+bool Synthesizer::initVoices() {
+    // 1. Create Mutex (once, so an offline instance can be reset)
+    if (voicesMutex == NULL) {
+        voicesMutex = xSemaphoreCreateMutex();
+        if (voicesMutex == NULL) {
+            Serial.println("Error: Failed to create voices mutex!");
+            return false;
+        }
+        Serial.println("- Mutex created.");
+    }
+
+    // 2. Initialize Voices (safely using mutex)
+    if (takeVoicesMutex()) {
+        for (int i = 0; i < SYNTH_MAX_VOICES; ++i) {
+            voices[i].isActive = false;
+            // Reset other fields if desired
+        }
+        for (int channel = 0; channel < 2; ++channel) {
+            decimators[channel][0].reset();
+            decimators[channel][1].reset();
+        }
+        xSemaphoreGive(voicesMutex);
+        Serial.println("- Voices initialized.");
+    } else {
+         Serial.println("Error: Failed to take mutex for voice init!");
+         return false;
+    }
+    return true;
+}
+
+
+void Synthesizer::setSampleRate(float rate) {
+    if (rate <= 0.0f) return;
+    if (voicesMutex == NULL) { // Not initialized yet: nobody else can be using the tables
+        buildRateTables_unsafe(rate);
+    } else if (takeVoicesMutex()) {
+        buildRateTables_unsafe(rate);
+        xSemaphoreGive(voicesMutex);
+    }
+}
+
+bool Synthesizer::setOversampling(int factor) {
+    if (!isSupportedOversampling(factor)) return false;
+    if (voicesMutex == NULL) { // Not initialized yet: nobody else can be using the tables
+        oversampling = factor;
+        buildRateTables_unsafe(sample_rate);
+    } else if (takeVoicesMutex()) {
+        oversampling = factor;
+        buildRateTables_unsafe(sample_rate);
+        for (int channel = 0; channel < 2; ++channel) {
+            decimators[channel][0].reset();
+            decimators[channel][1].reset();
+        }
+        xSemaphoreGive(voicesMutex);
+    }
+    return true;
+}
+
+bool Synthesizer::isSupportedOversampling(int factor) {
+    return factor == 1 || factor == 2 || factor == SYNTH_MAX_OVERSAMPLING;
+}
+
+bool Synthesizer::isSupportedSampleRate(uint32_t rate) {
+    for (size_t i = 0; i < sizeof(SYNTH_SUPPORTED_SAMPLE_RATES) / sizeof(SYNTH_SUPPORTED_SAMPLE_RATES[0]); ++i) {
+        if (SYNTH_SUPPORTED_SAMPLE_RATES[i] == rate) return true;
+    }
+    return false;
+}
+
+
 // --- Public Note Control Methods ---
 
-void Synthesizer::startNote(int noteNumber, int velocity) {
-    if (xSemaphoreTake(voicesMutex, portMAX_DELAY) == pdTRUE) {
+void Synthesizer::startNote(int noteNumber, int velocity, int channel) {
+    SYNTH_TRACE_INSTANT(TRACE_NOTE_ON, noteNumber);
+    if (takeVoicesMutex()) {
         int existingVoiceIndex = findVoicePlayingNote_unsafe(noteNumber);
         if (existingVoiceIndex != -1) {
              voices[existingVoiceIndex].isActive = false; // Stop existing note first
@@ -105,23 +292,9 @@ void Synthesizer::startNote(int noteNumber, int velocity) {
 
         int voiceIndex = findFreeVoice_unsafe();
         if (voiceIndex != -1) {
-            voices[voiceIndex].isActive = true;
-            voices[voiceIndex].midiNoteNumber = noteNumber;
-            voices[voiceIndex].frequency = midiNoteToFrequency(noteNumber);
-            voices[voiceIndex].targetAmplitude = velocityToAmplitude(velocity);
-            voices[voiceIndex].wavelength = calculate_wavelength(voices[voiceIndex].frequency);
-
-            if (voices[voiceIndex].wavelength > 0 && voices[voiceIndex].targetAmplitude != 0) {
-                voices[voiceIndex].currentOutput = voices[voiceIndex].targetAmplitude; // Start high
-                voices[voiceIndex].timeAtLevelRemaining = voices[voiceIndex].wavelength;
-            } else {
-                // Invalid note, deactivate immediately
-                voices[voiceIndex].isActive = false;
-                 Serial.printf("Warning: Cannot start note %d (freq=%.2f, amp=%d, wl=%d)\n",
-                              noteNumber, voices[voiceIndex].frequency, voices[voiceIndex].targetAmplitude, voices[voiceIndex].wavelength);
-            }
+            startVoice_unsafe(voiceIndex, noteNumber, velocity, channel);
         } else {
-             Serial.println("Warning: No free voices!");
+             synthLog.write(LOG_NO_FREE_VOICE, noteNumber); // Never Serial under the mutex
              // Implement voice stealing here if needed
         }
         xSemaphoreGive(voicesMutex);
@@ -129,7 +302,8 @@ void Synthesizer::startNote(int noteNumber, int velocity) {
 }
 
 void Synthesizer::stopNote(int noteNumber) {
-    if (xSemaphoreTake(voicesMutex, portMAX_DELAY) == pdTRUE) {
+    SYNTH_TRACE_INSTANT(TRACE_NOTE_OFF, noteNumber);
+    if (takeVoicesMutex()) {
         int voiceIndex = findVoicePlayingNote_unsafe(noteNumber);
         if (voiceIndex != -1) {
             voices[voiceIndex].isActive = false;
@@ -140,6 +314,183 @@ void Synthesizer::stopNote(int noteNumber) {
 }
 
 
+void Synthesizer::startNoteOnVoice(int voiceIndex, int noteNumber, int velocity, int channel) {
+    if (voiceIndex < 0 || voiceIndex >= SYNTH_MAX_VOICES) return;
+    SYNTH_TRACE_INSTANT(TRACE_NOTE_ON, noteNumber);
+    if (takeVoicesMutex()) {
+        // Voice was chosen offline; stealing simply overwrites whatever it was playing
+        startVoice_unsafe(voiceIndex, noteNumber, velocity, channel);
+        xSemaphoreGive(voicesMutex);
+    }
+}
+
+void Synthesizer::stopNoteOnVoice(int voiceIndex, int noteNumber) {
+    if (voiceIndex < 0 || voiceIndex >= SYNTH_MAX_VOICES) return;
+    SYNTH_TRACE_INSTANT(TRACE_NOTE_OFF, noteNumber);
+    if (takeVoicesMutex()) {
+        if (voices[voiceIndex].isActive && voices[voiceIndex].midiNoteNumber == noteNumber) {
+            voices[voiceIndex].isActive = false;
+            voices[voiceIndex].currentOutput = 0; // Stop sound immediately
+        }
+        xSemaphoreGive(voicesMutex);
+    }
+}
+
+
+void Synthesizer::setChannelPan(int channel, int pan) {
+    if (channel < 0 || channel >= SYNTH_MIDI_CHANNEL_COUNT) return;
+    if (takeVoicesMutex()) {
+        channel_pan[channel] = (uint8_t)constrain(pan, 0, 127);
+        for (int i = 0; i < SYNTH_MAX_VOICES; ++i) {
+            if (voices[i].isActive && voices[i].channel == channel) applyPan_unsafe(voices[i]);
+        }
+        xSemaphoreGive(voicesMutex);
+    }
+}
+
+void Synthesizer::resetControllers() {
+    if (takeVoicesMutex()) {
+        memset(channel_pan, SYNTH_PAN_CENTER, sizeof(channel_pan));
+        for (int i = 0; i < SYNTH_MAX_VOICES; ++i) {
+            if (voices[i].isActive) applyPan_unsafe(voices[i]);
+        }
+        xSemaphoreGive(voicesMutex);
+    }
+}
+
+
+void Synthesizer::renderBlock(int16_t* out, size_t sampleCount) {
+    // Safely access and update voices using the mutex
+    if (takeVoicesMutex()) {
+        if (oversampling == 1) {
+            for (size_t n = 0; n < sampleCount; ++n) {
+                out[n] = renderSample_unsafe();
+            }
+        } else {
+            for (size_t done = 0; done < sampleCount; done += SYNTH_OVERSAMPLING_CHUNK) {
+                size_t frames = sampleCount - done < SYNTH_OVERSAMPLING_CHUNK ? sampleCount - done : SYNTH_OVERSAMPLING_CHUNK;
+                int16_t* in = oversampledInput_unsafe(0);
+                for (size_t n = 0; n < frames * oversampling; ++n) {
+                    in[n] = renderSample_unsafe();
+                }
+                decimate_unsafe(0, frames, out + done, 1);
+            }
+        }
+        xSemaphoreGive(voicesMutex); // Release mutex
+    }
+}
+
+void Synthesizer::renderBlockStereo(int16_t* out, size_t frameCount) {
+    if (!takeVoicesMutex()) return;
+
+    // Voices only start and stop between blocks, so the averaging divisor is fixed per block
+    int activeVoiceCount = 0;
+    for (int i = 0; i < SYNTH_MAX_VOICES; ++i) {
+        if (voices[i].isActive) activeVoiceCount++;
+    }
+    // Q15 reciprocal. |sum| <= count * 1.41 * SYNTH_MAX_NOTE_AMPLITUDE, so sum * reciprocal fits in 32 bits.
+    int32_t reciprocal = activeVoiceCount ? (32768 + activeVoiceCount / 2) / activeVoiceCount : 0;
+
+    if (oversampling == 1) {
+        mixStereo_unsafe(out, out + 1, frameCount, 2, reciprocal);
+    } else {
+        for (size_t done = 0; done < frameCount; done += SYNTH_OVERSAMPLING_CHUNK) {
+            size_t frames = frameCount - done < SYNTH_OVERSAMPLING_CHUNK ? frameCount - done : SYNTH_OVERSAMPLING_CHUNK;
+            mixStereo_unsafe(oversampledInput_unsafe(0), oversampledInput_unsafe(1), frames * oversampling, 1, reciprocal);
+            decimate_unsafe(0, frames, out + 2 * done, 2);
+            decimate_unsafe(1, frames, out + 2 * done + 1, 2);
+        }
+    }
+    xSemaphoreGive(voicesMutex);
+}
+
+
+void Synthesizer::getStats(SynthStats& out) const {
+    uint32_t blocks, max_cycles, underruns, min_slack_us, starved;
+    uint64_t total_cycles, total_slack_us;
+    uint64_t master_cycles[MASTER_STAGE_COUNT];
+    uint32_t before, after;
+    do {
+        before = stats_sequence.load(std::memory_order_acquire);
+        blocks = stats_blocks;
+        total_cycles = stats_total_cycles;
+        max_cycles = stats_max_cycles;
+        underruns = stats_underruns;
+        total_slack_us = stats_total_slack_us;
+        min_slack_us = stats_min_slack_us;
+        starved = stats_starved;
+        memcpy(master_cycles, stats_master_cycles, sizeof(master_cycles));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = stats_sequence.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+
+    out.blocks = blocks;
+    out.budget_cycles = stats_budget_cycles;
+    out.avg_render_cycles = blocks ? (uint32_t)(total_cycles / blocks) : 0;
+    out.max_render_cycles = max_cycles;
+    out.load_percent = stats_budget_cycles ? 100.0f * out.avg_render_cycles / stats_budget_cycles : 0.0f;
+    out.peak_load_percent = stats_budget_cycles ? 100.0f * max_cycles / stats_budget_cycles : 0.0f;
+    out.underruns = underruns;
+    out.min_slack_us = blocks ? min_slack_us : 0;
+    out.avg_slack_us = blocks ? (uint32_t)(total_slack_us / blocks) : 0;
+    out.starved_blocks = starved;
+    for (int stage = 0; stage < MASTER_STAGE_COUNT; ++stage) {
+        out.avg_master_cycles[stage] = blocks ? (uint32_t)(master_cycles[stage] / blocks) : 0;
+    }
+}
+
+void Synthesizer::resetStats() {
+    stats_reset_requested.store(true, std::memory_order_release);
+}
+
+uint32_t Synthesizer::outputLatencyMicros() const {
+    uint32_t block_start_us = last_block_start_us.load(std::memory_order_relaxed);
+    if (block_start_us == 0) return 0;
+
+    // With the ring full, rendering is paced by the output task freeing a slot,
+    // so blocks start one block period apart
+    uint32_t since_start_us = micros() - block_start_us;
+    uint32_t until_next_block_us = since_start_us < block_us ? block_us - since_start_us : 0;
+    // Blocks waiting in the ring, plus the one the output task is writing
+    uint32_t queued_blocks = (uint32_t)uxQueueMessagesWaiting(ready_slots) + 1;
+    return until_next_block_us + queued_blocks * block_us + dma_latency_us;
+}
+
+uint32_t Synthesizer::worstCaseLatencyMicros(const SynthOutputConfig& config) {
+    uint64_t frames = (uint64_t)config.dma_buf_count * config.dma_buf_len +
+                      (uint64_t)(config.render_ahead_blocks + 1) * SYNTH_RENDER_BLOCK_SAMPLES;
+    return (uint32_t)(frames * 1000000ULL / config.sample_rate);
+}
+
+SynthOutputConfig Synthesizer::recommendedOutputConfig() const {
+    SynthStats stats;
+    getStats(stats);
+    uint64_t render_cycles = stats.blocks > 0 ? stats.max_render_cycles : stats.budget_cycles;
+    uint32_t cpu_mhz = ESP.getCpuFreqMHz();
+
+    // Frames that play while the slowest block renders, with the safety margin
+    uint64_t frames = (uint64_t)SYNTH_RENDER_BLOCK_SAMPLES; // No measurement and no budget: one block
+    if (render_cycles > 0 && cpu_mhz > 0) {
+        frames = (uint64_t)ceil((double)render_cycles * SYNTH_LATENCY_SAFETY_FACTOR * sample_rate / (cpu_mhz * 1e6));
+    }
+
+    // i2s_write refills as soon as one buffer frees up, so at least count - 1
+    // buffers are still queued when the next block starts rendering, on top of
+    // the other full slots of the render-ahead ring
+    SynthOutputConfig config;
+    config.sample_rate = (uint32_t)lroundf(sample_rate); // Keep the current rate and ring
+    config.render_ahead_blocks = render_ahead_blocks;
+    config.oversampling = oversampling;
+    config.master = master_chain.config();
+    config.dma_buf_len = SYNTH_RENDER_BLOCK_SAMPLES;
+    uint64_t ring_frames = (uint64_t)(render_ahead_blocks - 1) * SYNTH_RENDER_BLOCK_SAMPLES;
+    frames = frames > ring_frames ? frames - ring_frames : 0;
+    uint64_t count = 1 + (frames + config.dma_buf_len - 1) / config.dma_buf_len;
+    config.dma_buf_count = (int)constrain(count, (uint64_t)SYNTH_DMA_BUF_COUNT_MIN, (uint64_t)SYNTH_DMA_BUF_COUNT_MAX);
+    return config;
+}
+
+
 // --- Private Helper Methods ---
 
 float Synthesizer::midiNoteToFrequency(int midiNote) {
@@ -155,11 +506,115 @@ int16_t Synthesizer::velocityToAmplitude(int velocity) {
 
 uint16_t Synthesizer::calculate_wavelength(float frequency) {
     if (frequency <= 0) return 0;
-    float samples_per_half_cycle_f = (float)SYNTH_SAMPLE_RATE / (frequency * 2.0f);
+    float samples_per_half_cycle_f = sample_rate * oversampling / (frequency * 2.0f);
     uint16_t wavelength = (uint16_t)roundf(samples_per_half_cycle_f);
     return (wavelength < 1) ? 1 : wavelength;
 }
 
+void Synthesizer::startVoice_unsafe(int voiceIndex, int noteNumber, int velocity, int channel) {
+    VoiceState &voice = voices[voiceIndex];
+    voice.isActive = true;
+    voice.midiNoteNumber = noteNumber;
+    voice.targetAmplitude = velocityToAmplitude(velocity);
+    voice.channel = (channel >= 0 && channel < SYNTH_MIDI_CHANNEL_COUNT) ? channel : 0;
+    applyPan_unsafe(voice);
+    voice.wavelength = (noteNumber >= 0 && noteNumber < SYNTH_MIDI_NOTE_COUNT) ? note_wavelengths[noteNumber] : 0;
+    voice.frequency = voice.wavelength ? sample_rate * oversampling / (2.0f * voice.wavelength) : 0.0f; // Pitch actually played
+
+    if (voice.wavelength > 0 && voice.targetAmplitude != 0) {
+        voice.currentOutput = voice.targetAmplitude; // Start high
+        voice.timeAtLevelRemaining = voice.wavelength;
+    } else {
+        // Invalid note, deactivate immediately
+        voice.isActive = false;
+        synthLog.write(LOG_CANNOT_START_NOTE, noteNumber, (int32_t)roundf(voice.frequency),
+                       voice.targetAmplitude, voice.wavelength);
+    }
+}
+
+void Synthesizer::applyPan_unsafe(VoiceState& voice) {
+    uint8_t pan = channel_pan[voice.channel];
+    int position = pan > 0 ? pan - 1 : 0; // 0-126
+    voice.levelLeft = (int16_t)(((int32_t)voice.targetAmplitude * PAN_LAW_Q14[position] + 8192) >> 14);
+    voice.levelRight = (int16_t)(((int32_t)voice.targetAmplitude * PAN_LAW_Q14[PAN_LAW_POSITIONS - 1 - position] + 8192) >> 14);
+}
+
+void Synthesizer::buildRateTables_unsafe(float rate) {
+    sample_rate = rate;
+    for (int note = 0; note < SYNTH_MIDI_NOTE_COUNT; ++note) {
+        note_wavelengths[note] = calculate_wavelength(midiNoteToFrequency(note));
+    }
+    block_us = (uint32_t)lroundf(SYNTH_RENDER_BLOCK_SAMPLES * 1000000.0f / rate);
+}
+
+bool Synthesizer::takeVoicesMutex() {
+    SYNTH_TRACE_BEGIN(TRACE_MUTEX_WAIT, 0);
+    bool taken = xSemaphoreTake(voicesMutex, portMAX_DELAY) == pdTRUE;
+    SYNTH_TRACE_END(TRACE_MUTEX_WAIT, 0);
+    return taken;
+}
+
+int16_t Synthesizer::renderSample_unsafe() {
+    int32_t summedSample_raw = 0;
+    int activeVoiceCount = 0;
+
+    for (int i = 0; i < SYNTH_MAX_VOICES; ++i) {
+        if (voices[i].isActive) {
+            activeVoiceCount++;
+            VoiceState &voice = voices[i]; // Use reference
+
+            // Update square wave state
+            advanceSquareWave(voice);
+
+            summedSample_raw += voice.currentOutput;
+        }
+    }
+
+    // Mix, Scale, Clamp
+    if (activeVoiceCount == 0) {
+        return SYNTH_SILENCE_AMPLITUDE;
+    }
+    float mixedSample_f = (float)summedSample_raw / (float)activeVoiceCount; // Averaging
+
+    // Hard Clamping
+    if (mixedSample_f > SYNTH_MAX_OUTPUT_AMPLITUDE) return SYNTH_MAX_OUTPUT_AMPLITUDE;
+    if (mixedSample_f < SYNTH_MIN_OUTPUT_AMPLITUDE) return SYNTH_MIN_OUTPUT_AMPLITUDE;
+    return (int16_t)roundf(mixedSample_f);
+}
+
+void Synthesizer::mixStereo_unsafe(int16_t* left, int16_t* right, size_t count, size_t stride, int32_t reciprocal) {
+    for (size_t n = 0; n < count; ++n) {
+        int32_t left_sum = 0;
+        int32_t right_sum = 0;
+        for (int i = 0; i < SYNTH_MAX_VOICES; ++i) {
+            VoiceState &voice = voices[i];
+            if (!voice.isActive) continue;
+            advanceSquareWave(voice);
+            // currentOutput is +-targetAmplitude: the panned levels carry the same sign
+            if (voice.currentOutput > 0) {
+                left_sum += voice.levelLeft;
+                right_sum += voice.levelRight;
+            } else {
+                left_sum -= voice.levelLeft;
+                right_sum -= voice.levelRight;
+            }
+        }
+        left[n * stride] = (int16_t)((left_sum * reciprocal + 16384) >> 15);
+        right[n * stride] = (int16_t)((right_sum * reciprocal + 16384) >> 15);
+    }
+}
+
+int16_t* Synthesizer::oversampledInput_unsafe(int channel) {
+    return decimators[channel][oversampling == SYNTH_MAX_OVERSAMPLING ? 0 : 1].input();
+}
+
+void Synthesizer::decimate_unsafe(int channel, size_t frames, int16_t* out, size_t stride) {
+    if (oversampling == SYNTH_MAX_OVERSAMPLING) {
+        decimators[channel][0].decimate(frames * 4, decimators[channel][1].input(), 1);
+    }
+    decimators[channel][1].decimate(frames * 2, out, stride);
+}
+
 int Synthesizer::findFreeVoice_unsafe() {
     for (int i = 0; i < SYNTH_MAX_VOICES; ++i) {
         if (!voices[i].isActive) return i;
@@ -174,70 +629,138 @@ int Synthesizer::findVoicePlayingNote_unsafe(int midiNoteNumber) {
     return -1;
 }
 
-void Synthesizer::send_sample_to_i2s(int16_t sample_value) {
-    uint32_t sample_32bit = ((uint32_t)(sample_value & 0xFFFF) << 16) | (sample_value & 0xFFFF);
+size_t Synthesizer::packFrames(const int16_t* samples, size_t sampleCount, uint32_t* words) {
+    // Mono: two frames per word. Stereo: one frame per word, left first.
+    for (size_t n = 0; n + 1 < sampleCount; n += 2) {
+        words[n / 2] = ((uint32_t)(samples[n] & 0xFFFF) << 16) | (samples[n + 1] & 0xFFFF);
+    }
+    return sampleCount / 2;
+}
+
+size_t Synthesizer::dmaBufferBytes() const {
+    return (size_t)i2s_config.dma_buf_count * i2s_config.dma_buf_len * SYNTH_OUTPUT_CHANNELS * sizeof(int16_t);
+}
+
+void Synthesizer::send_block_to_i2s(const int16_t* samples, size_t sampleCount) {
+    static_assert(SYNTH_RENDER_BLOCK_SAMPLES % 2 == 0, "Mono frames are packed in pairs");
+    static uint32_t words[SYNTH_RENDER_BLOCK_SAMPLES * SYNTH_OUTPUT_CHANNELS / 2];
+    size_t word_count = packFrames(samples, sampleCount, words);
     size_t bytes_written = 0;
-    i2s_write(i2s_port, &sample_32bit, sizeof(sample_32bit), &bytes_written, portMAX_DELAY);
+    i2s_write(i2s_port, words, word_count * sizeof(words[0]), &bytes_written, portMAX_DELAY);
+}
+
+// Drain the I2S driver's event queue; returns the number of underruns it reported
+uint32_t Synthesizer::pollI2sEvents() {
+    uint32_t underruns = 0;
+    i2s_event_t event;
+    while (i2s_event_queue != NULL && xQueueReceive(i2s_event_queue, &event, 0) == pdTRUE) {
+        if (event.type == I2S_EVENT_TX_Q_OVF) underruns++;
+    }
+    return underruns;
+}
+
+void Synthesizer::recordBlockStats(uint32_t render_cycles, const uint32_t* master_cycles, uint32_t new_underruns,
+                                   uint32_t slack_us, bool starved) {
+    uint32_t sequence = stats_sequence.load(std::memory_order_relaxed);
+    stats_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (stats_reset_requested.exchange(false, std::memory_order_acquire)) {
+        stats_blocks = 0;
+        stats_total_cycles = 0;
+        stats_max_cycles = 0;
+        stats_underruns = 0;
+        stats_total_slack_us = 0;
+        stats_min_slack_us = UINT32_MAX;
+        stats_starved = 0;
+        memset(stats_master_cycles, 0, sizeof(stats_master_cycles));
+    }
+    stats_blocks++;
+    stats_total_cycles += render_cycles;
+    if (render_cycles > stats_max_cycles) stats_max_cycles = render_cycles;
+    stats_underruns += new_underruns;
+    stats_total_slack_us += slack_us;
+    if (slack_us < stats_min_slack_us) stats_min_slack_us = slack_us;
+    if (starved) stats_starved++;
+    for (int stage = 0; stage < MASTER_STAGE_COUNT; ++stage) {
+        stats_master_cycles[stage] += master_cycles[stage];
+    }
+
+    stats_sequence.store(sequence + 2, std::memory_order_release);
 }
 
 
 // --- Audio Task Implementation ---
 
-// Static wrapper function required by xTaskCreate
-void Synthesizer::audioTaskWrapper(void* instance) {
+// Static wrapper functions required by xTaskCreate
+void Synthesizer::renderTaskWrapper(void* instance) {
     // Cast the instance pointer back to Synthesizer* and call the member function
     if (instance) {
-        static_cast<Synthesizer*>(instance)->audioTaskRunner();
+        static_cast<Synthesizer*>(instance)->renderTaskRunner();
     }
     // Task should not return, but if it does, delete it.
      vTaskDelete(NULL);
 }
 
-// The actual audio generation loop running in the task
-void Synthesizer::audioTaskRunner() {
-    Serial.println("Synthesizer::audioTaskRunner started.");
+void Synthesizer::outputTaskWrapper(void* instance) {
+    if (instance) {
+        static_cast<Synthesizer*>(instance)->outputTaskRunner();
+    }
+    vTaskDelete(NULL);
+}
+
+// Render stage: fill the next free slot of the ring, as far ahead as the ring allows
+void Synthesizer::renderTaskRunner() {
+    Serial.println("Synthesizer::renderTaskRunner started.");
     while (true) {
-        int32_t summedSample_raw = 0;
-        int activeVoiceCount = 0;
-
-        // Safely access and update voices using the mutex
-        if (xSemaphoreTake(voicesMutex, portMAX_DELAY) == pdTRUE) {
-            for (int i = 0; i < SYNTH_MAX_VOICES; ++i) {
-                if (voices[i].isActive) {
-                    activeVoiceCount++;
-                    VoiceState &voice = voices[i]; // Use reference
-
-                    // Update square wave state
-                    if (voice.timeAtLevelRemaining == 0) {
-                        voice.currentOutput = (voice.currentOutput == voice.targetAmplitude)
-                                                 ? -voice.targetAmplitude
-                                                 : voice.targetAmplitude;
-                        voice.timeAtLevelRemaining = voice.wavelength;
-                    }
-                    if(voice.timeAtLevelRemaining > 0) {
-                       voice.timeAtLevelRemaining--;
-                    }
-
-                    summedSample_raw += voice.currentOutput;
-                }
-            }
-            xSemaphoreGive(voicesMutex); // Release mutex
-        } // End mutex lock
-
-        // Mix, Scale, Clamp
-        int16_t finalSample = 0;
-        if (activeVoiceCount > 0) {
-            float mixedSample_f = (float)summedSample_raw / (float)activeVoiceCount; // Averaging
-
-            // Hard Clamping
-            if (mixedSample_f > SYNTH_MAX_OUTPUT_AMPLITUDE) finalSample = SYNTH_MAX_OUTPUT_AMPLITUDE;
-            else if (mixedSample_f < SYNTH_MIN_OUTPUT_AMPLITUDE) finalSample = SYNTH_MIN_OUTPUT_AMPLITUDE;
-            else finalSample = (int16_t)roundf(mixedSample_f);
-        } else {
-            finalSample = SYNTH_SILENCE_AMPLITUDE;
+        uint8_t slot;
+        SYNTH_TRACE_BEGIN(TRACE_FREE_SLOT_WAIT, 0);
+        xQueueReceive(free_slots, &slot, portMAX_DELAY); // Blocks while the ring is full, pacing the loop
+        SYNTH_TRACE_END(TRACE_FREE_SLOT_WAIT, slot);
+        int16_t* block = render_ring + slot * SYNTH_RENDER_BLOCK_SAMPLES * SYNTH_OUTPUT_CHANNELS;
+
+        last_block_start_us.store(micros() | 1, std::memory_order_relaxed); // Never 0 once running
+        SYNTH_TRACE_BEGIN(TRACE_RENDER_BLOCK, slot);
+        uint32_t start_cycles = ESP.getCycleCount();
+#if SYNTH_MONO_OUTPUT
+        renderBlock(block, SYNTH_RENDER_BLOCK_SAMPLES);
+#else
+        renderBlockStereo(block, SYNTH_RENDER_BLOCK_SAMPLES);
+#endif
+        master_chain.process(block, SYNTH_RENDER_BLOCK_SAMPLES, slot_master_cycles[slot]); // Outside the voices mutex
+        slot_render_cycles[slot] = ESP.getCycleCount() - start_cycles;
+        SYNTH_TRACE_END(TRACE_RENDER_BLOCK, slot);
+
+        slot_ready_us[slot] = micros();
+        xQueueSend(ready_slots, &slot, portMAX_DELAY); // The queue publishes the slot's contents
+    } // End while(true)
+}
+
+// Output stage: write rendered blocks to I2S in order. Slack is how long a block
+// sat ready before it was needed; a block that was not ready yet starved the output.
+void Synthesizer::outputTaskRunner() {
+    Serial.println("Synthesizer::outputTaskRunner started.");
+    bool first_block = true; // Nothing can be rendered ahead of it: kept out of the stats
+    while (true) {
+        uint8_t slot;
+        bool starved = xQueueReceive(ready_slots, &slot, 0) != pdTRUE;
+        if (starved) {
+            SYNTH_TRACE_BEGIN(TRACE_READY_SLOT_WAIT, 0);
+            xQueueReceive(ready_slots, &slot, portMAX_DELAY);
+            SYNTH_TRACE_END(TRACE_READY_SLOT_WAIT, slot);
+        }
+        if (!first_block) {
+            uint32_t slack_us = starved ? 0 : micros() - slot_ready_us[slot];
+            recordBlockStats(slot_render_cycles[slot], slot_master_cycles[slot], pollI2sEvents(), slack_us, starved);
         }
+        first_block = false;
 
-        // Send to I2S (this blocks, pacing the loop)
-        send_sample_to_i2s(finalSample);
+        // Send to I2S (this blocks until the DMA has room, pacing the loop)
+        SYNTH_TRACE_BEGIN(TRACE_I2S_WRITE, slot);
+        send_block_to_i2s(render_ring + slot * SYNTH_RENDER_BLOCK_SAMPLES * SYNTH_OUTPUT_CHANNELS,
+                          SYNTH_RENDER_BLOCK_SAMPLES * SYNTH_OUTPUT_CHANNELS);
+        SYNTH_TRACE_END(TRACE_I2S_WRITE, slot);
+
+        xQueueSend(free_slots, &slot, portMAX_DELAY);
     } // End while(true)
-}
\ No newline at end of file
+}
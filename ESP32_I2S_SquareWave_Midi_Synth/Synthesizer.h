@@ -5,17 +5,59 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
 #include <cstdint> // For standard integer types like int16_t
+#include <atomic>  // For the lock-free stats snapshot
+#include "HalfBandDecimator.h" // For oversampling
+#include "MasterChain.h"       // Master bus effects
 
 // --- Configuration Constants ---
 // You might move these into the class later or pass them via constructor if needed
-const int SYNTH_SAMPLE_RATE = 44100;
+const int SYNTH_SAMPLE_RATE = 44100;          // Default; pick another with SynthOutputConfig
+// Rates init() accepts. Lower rates cost proportionally less CPU, at the price of coarser pitch
+// for high notes (each square wave half-period is a whole number of samples).
+const uint32_t SYNTH_SUPPORTED_SAMPLE_RATES[] = { 16000, 22050, 32000, 44100, 48000 };
+const int SYNTH_MIDI_NOTE_COUNT = 128;
+const int SYNTH_MIDI_CHANNEL_COUNT = 16;
+const uint8_t SYNTH_PAN_CENTER = 64;         // MIDI CC10 value: 0 = hard left, 64 = center, 127 = hard right
 const int SYNTH_BITS_PER_SAMPLE = 16;
-const int SYNTH_MAX_VOICES = 8;               // Max simultaneous notes
+// Max simultaneous notes. Set here, or with -DSYNTH_VOICES=N (the host benchmark
+// sweeps up to 64). Songs with pre-allocated voices can address at most 15.
+#ifndef SYNTH_VOICES
+#define SYNTH_VOICES 8
+#endif
+const int SYNTH_MAX_VOICES = SYNTH_VOICES;
 const int16_t SYNTH_MAX_NOTE_AMPLITUDE = 16000;// Max amplitude for ONE note (tune this!) //4000
 const int16_t SYNTH_MAX_OUTPUT_AMPLITUDE = 32767; // Absolute MAX output
 const int16_t SYNTH_MIN_OUTPUT_AMPLITUDE = -32768;// Absolute MIN output
 const int16_t SYNTH_SILENCE_AMPLITUDE = 0;
+const int SYNTH_RENDER_BLOCK_SAMPLES = 64;    // Samples per audio task pass (~1.5 ms): note changes apply per block
+const int SYNTH_I2S_EVENT_QUEUE_LENGTH = 16;  // I2S driver events (TX done, underruns) drained every block
+
+// --- Output Format ---
+// 1 = mono frames (I2S_CHANNEL_FMT_ONLY_LEFT) for single-speaker builds: half the DMA
+// memory and bus bandwidth, channel pan is ignored. 0 = stereo frames panned per MIDI
+// channel (CC10). Set here, or with -DSYNTH_MONO_OUTPUT=1.
+#ifndef SYNTH_MONO_OUTPUT
+#define SYNTH_MONO_OUTPUT 0
+#endif
+const int SYNTH_OUTPUT_CHANNELS = SYNTH_MONO_OUTPUT ? 1 : 2;
+
+// --- DMA Buffer Limits ---
+const int SYNTH_DMA_BUF_COUNT_MIN = 2;       // I2S driver limits
+const int SYNTH_DMA_BUF_COUNT_MAX = 128;
+const int SYNTH_DMA_BUF_LEN_MIN = 8;
+const int SYNTH_DMA_BUF_LEN_MAX = 1024;
+const int SYNTH_LATENCY_SAFETY_FACTOR = 2;   // Queued audio per worst render block, see recommendedOutputConfig()
+const int SYNTH_MAX_RENDER_AHEAD = 8;        // Largest ring of pre-rendered blocks
+
+// --- Oversampling ---
+// 2 or 4: voices run at that multiple of the sample rate and half-band filters
+// (HalfBandDecimator) bring the mix down, so the harmonics of high notes no longer
+// fold back below Nyquist, and pitch steps get 2-4x finer. Render CPU time grows
+// about in proportion. synth_render --alias-check (host build) measures the folded energy per tier.
+const int SYNTH_MAX_OVERSAMPLING = 4;
+const int SYNTH_OVERSAMPLING_CHUNK = (int)HalfBandDecimator::MAX_INPUT / SYNTH_MAX_OVERSAMPLING; // Output samples per decimation pass
 
 // --- I2S Pin Configuration ---
 // Define pins here, or pass them to init()
@@ -34,6 +76,43 @@ struct VoiceState
     int16_t currentOutput = 0;
     uint16_t wavelength = 0;
     uint16_t timeAtLevelRemaining = 0;
+    uint8_t channel = 0;      // MIDI channel, selects the pan
+    int16_t levelLeft = 0;    // targetAmplitude through the channel's pan law, for stereo rendering
+    int16_t levelRight = 0;
+};
+
+// --- Output Buffer Configuration ---
+// Passed to Synthesizer::init(). Everything queued in the render-ahead ring and the DMA
+// buffers plays before a note change does: the defaults hold ~190 ms, safe but too slow
+// for live input.
+struct SynthOutputConfig
+{
+    uint32_t sample_rate = SYNTH_SAMPLE_RATE; // One of SYNTH_SUPPORTED_SAMPLE_RATES
+    bool use_apll = true;    // Audio PLL: the real rate lands within a few ppm of sample_rate
+    int dma_buf_count = 8;   // Number of DMA buffers
+    int dma_buf_len = 1024;  // Frames per buffer
+    int render_ahead_blocks = 2; // Blocks the render task may get ahead of the output task (2 = ping-pong)
+    int oversampling = 1;    // 1, 2 or 4, see SYNTH_MAX_OVERSAMPLING
+    MasterChainConfig master; // Effects between the mix and the DAC; none by default
+};
+
+// --- Audio Task Statistics ---
+// Snapshot returned by Synthesizer::getStats()
+struct SynthStats
+{
+    uint32_t blocks = 0;              // Render blocks since the last reset
+    uint32_t budget_cycles = 0;       // CPU cycles one block may take in real time
+    uint32_t avg_render_cycles = 0;
+    uint32_t max_render_cycles = 0;   // Worst block since the last reset
+    float load_percent = 0.0f;        // Average render time as a share of the budget
+    float peak_load_percent = 0.0f;   // Worst block as a share of the budget
+    uint32_t underruns = 0;           // I2S TX queue overflows: the DMA ran out of data
+    uint32_t min_slack_us = 0;        // Shortest time a rendered block waited for the output task
+    uint32_t avg_slack_us = 0;
+    uint32_t starved_blocks = 0;      // Blocks the output task had to wait for: the render-ahead ring ran dry
+    // Average cycles per block of each master chain stage, indexed by MasterStage (0 = not in
+    // the chain). Already part of the render cycles above.
+    uint32_t avg_master_cycles[MASTER_STAGE_COUNT] = {};
 };
 
 
@@ -46,33 +125,165 @@ public:
     // ~Synthesizer();
 
     // Call this in setup()
-    bool init();
+    bool init(const SynthOutputConfig& config = SynthOutputConfig());
+
+    // Create the mutex and reset all voices (and the decimation filters) without starting
+    // I2S or the audio task. init() calls this; on its own it gives an offline instance
+    // driven by renderBlock().
+    bool initVoices();
+
+    // Rebuild the pitch and timing tables for this sample rate. init() calls it with the
+    // rate the I2S clock actually achieved; call it directly only on an offline instance.
+    // Defaults to SYNTH_SAMPLE_RATE.
+    void setSampleRate(float rate);
+    float sampleRate() const { return sample_rate; }
+
+    static bool isSupportedSampleRate(uint32_t rate);
 
-    // Public interface to control notes
-    void startNote(int noteNumber, int velocity);
+    // Render voices at factor times the sample rate (1, 2 or 4) and decimate.
+    // init() applies SynthOutputConfig::oversampling; call it directly only on an
+    // offline instance. Returns false for an unsupported factor.
+    bool setOversampling(int factor);
+    int oversamplingFactor() const { return oversampling; }
+
+    static bool isSupportedOversampling(int factor);
+
+    // Public interface to control notes. channel (0-15) selects the pan.
+    void startNote(int noteNumber, int velocity, int channel = 0);
     void stopNote(int noteNumber);
 
+    // Direct-indexed fast path for songs with pre-allocated voices.
+    // No voice search: the caller (song converter) already decided the voice.
+    void startNoteOnVoice(int voiceIndex, int noteNumber, int velocity, int channel = 0);
+    void stopNoteOnVoice(int voiceIndex, int noteNumber);
+
+    // MIDI CC10 for one channel (0 = hard left, 64 = center, 127 = hard right).
+    // Applies to notes already sounding on the channel as well as new ones.
+    void setChannelPan(int channel, int pan);
+    // Center every channel, as a MIDI Reset All Controllers. The player calls it at song start.
+    void resetControllers();
+
+    // Mix the next sampleCount mono samples into out, holding the mutex once per block.
+    // The audio task uses this; call it directly only on an instance without an audio task.
+    void renderBlock(int16_t* out, size_t sampleCount);
+
+    // Same for frameCount stereo frames, interleaved left, right. Integer only: each
+    // voice carries its level through a constant-power pan law (a center pan keeps the
+    // mono level), and the voice average uses a reciprocal computed once per block.
+    void renderBlockStereo(int16_t* out, size_t frameCount);
+
+    // Pack rendered samples (interleaved when stereo) into the 32-bit words the I2S DMA
+    // reads, two per word with the earlier sample in the upper half: the ESP32 shifts out
+    // the upper half first, so a stereo frame puts left there. sampleCount must be even.
+    // Returns the word count.
+    static size_t packFrames(const int16_t* samples, size_t sampleCount, uint32_t* words);
+
+    // DMA buffer memory the I2S driver allocates for the configured output format
+    size_t dmaBufferBytes() const;
+
+    // Copy of the audio task statistics. Lock-free: never blocks the audio tasks,
+    // callable from any task or core. Collection is always on and costs a few
+    // cycle counter reads and stores per block.
+    void getStats(SynthStats& out) const;
+    // Restart the statistics; the output task applies this at its next block
+    void resetStats();
+
+    // Estimated time until a note change made now reaches the DAC: the wait for
+    // the next render block plus the audio already queued in the render-ahead ring
+    // and the DMA buffers. 0 when the audio tasks are not running.
+    uint32_t outputLatencyMicros() const;
+
+    // Worst-case time from a note change to the DAC with this configuration: the wait
+    // for the next render, a full render-ahead ring, the block being written and a full DMA queue.
+    static uint32_t worstCaseLatencyMicros(const SynthOutputConfig& config);
+
+    // Smallest buffers expected to run without underruns: one render block per buffer
+    // and enough of them, together with the render-ahead ring, to cover
+    // SYNTH_LATENCY_SAFETY_FACTOR times the slowest block measured since the last
+    // resetStats(). Let a busy song play first; before any block is measured a block
+    // is assumed to take its whole real-time budget.
+    SynthOutputConfig recommendedOutputConfig() const;
+
 private:
     // --- I2S Members ---
     i2s_port_t i2s_port;
     i2s_config_t i2s_config;
     i2s_pin_config_t i2s_pin_config;
 
+    QueueHandle_t i2s_event_queue;
+
     // --- Voice Management Members ---
     VoiceState voices[SYNTH_MAX_VOICES];
     SemaphoreHandle_t voicesMutex;
+    uint8_t channel_pan[SYNTH_MIDI_CHANNEL_COUNT]; // Latest CC10 per channel
+
+    // --- Rate-Dependent Tables ---
+    float sample_rate;                                   // Achieved rate the tables are built for
+    int oversampling;                                    // Voices run at sample_rate * oversampling
+    uint16_t note_wavelengths[SYNTH_MIDI_NOTE_COUNT];    // Half-period in voice samples per MIDI note, 0 = silent
+    uint32_t block_us;                                   // Duration of one render block
+
+    // --- Oversampling ---
+    // Per output channel: [0] = 4x -> 2x (FILTER_SHORT), [1] = 2x -> 1x (FILTER_SHARP)
+    HalfBandDecimator decimators[2][2];
+
+    // --- Master Bus ---
+    MasterChain master_chain; // Run by the render task on each finished block
 
     // --- Private Helper Methods ---
     float midiNoteToFrequency(int midiNote);
     int16_t velocityToAmplitude(int velocity);
     uint16_t calculate_wavelength(float frequency);
+    void buildRateTables_unsafe(float rate); // Must hold mutex (or be the only user)
     int findFreeVoice_unsafe(); // Must hold mutex before calling
     int findVoicePlayingNote_unsafe(int midiNoteNumber); // Must hold mutex
+    void startVoice_unsafe(int voiceIndex, int noteNumber, int velocity, int channel); // Must hold mutex
+    void applyPan_unsafe(VoiceState& voice); // Must hold mutex
+    int16_t renderSample_unsafe(); // Must hold mutex
+    // Panned stereo mix of count voice samples; reciprocal = Q15 1 / active voices
+    void mixStereo_unsafe(int16_t* left, int16_t* right, size_t count, size_t stride, int32_t reciprocal);
+    int16_t* oversampledInput_unsafe(int channel); // Where to render a chunk at the voice rate
+    void decimate_unsafe(int channel, size_t frames, int16_t* out, size_t stride); // Chunk down to frames outputs
+    bool takeVoicesMutex();        // Blocking take, traced as a mutex wait
+
+    // --- Audio Task Statistics ---
+    // Written only by the output task; published with a sequence counter (seqlock):
+    // odd while an update is in progress, readers retry until they see a stable even value.
+    std::atomic<uint32_t> stats_sequence;
+    std::atomic<bool> stats_reset_requested;
+    uint32_t stats_budget_cycles;
+    uint32_t stats_blocks;
+    uint64_t stats_total_cycles;
+    uint32_t stats_max_cycles;
+    uint32_t stats_underruns;
+    uint64_t stats_total_slack_us;
+    uint32_t stats_min_slack_us;
+    uint32_t stats_starved;
+    uint64_t stats_master_cycles[MASTER_STAGE_COUNT];
+    std::atomic<uint32_t> last_block_start_us; // micros() at the start of the latest render block
+    uint32_t dma_latency_us;                   // Audio held by the full DMA buffers
+
+    void recordBlockStats(uint32_t render_cycles, const uint32_t* master_cycles, uint32_t new_underruns,
+                          uint32_t slack_us, bool starved);
+    uint32_t pollI2sEvents();
+
+    // --- Render-Ahead Ring ---
+    // The render task fills free slots, the output task writes full ones to I2S. Slot
+    // indices travel through two queues, so every slot has exactly one owner at a time.
+    int render_ahead_blocks;
+    int16_t* render_ring;            // render_ahead_blocks blocks of SYNTH_RENDER_BLOCK_SAMPLES frames
+    QueueHandle_t free_slots;
+    QueueHandle_t ready_slots;
+    uint32_t slot_ready_us[SYNTH_MAX_RENDER_AHEAD];      // micros() when the slot finished rendering
+    uint32_t slot_render_cycles[SYNTH_MAX_RENDER_AHEAD];
+    uint32_t slot_master_cycles[SYNTH_MAX_RENDER_AHEAD][MASTER_STAGE_COUNT];
 
-    // --- Audio Task ---
-    void send_sample_to_i2s(int16_t sample_value);
-    void audioTaskRunner(); // The actual task loop method
-    static void audioTaskWrapper(void* instance); // Static wrapper for xTaskCreate
+    // --- Audio Tasks ---
+    void send_block_to_i2s(const int16_t* samples, size_t sampleCount);
+    void renderTaskRunner(); // Mixes blocks into the ring
+    void outputTaskRunner(); // Writes them to I2S, paced by the DMA
+    static void renderTaskWrapper(void* instance); // Static wrappers for xTaskCreate
+    static void outputTaskWrapper(void* instance);
 };
 
 #endif // SYNTHESIZER_H
\ No newline at end of file
@@ -0,0 +1,307 @@
+"""
+Polyphony: voice pre-allocation and note stealing, drop reports, and reducing a
+song to the voice budget (--fit) or a coarser grid (--coalesce).
+"""
+import time
+import os
+
+from songformat import (
+    DEFAULT_TEMPO_US, EVENT_TYPE_CONTROL, EVENT_TYPE_NOTE_OFF, EVENT_TYPE_NOTE_ON,
+    EVENT_TYPE_TEMPO, MIDI_CC_PAN, MIDI_CHANNELS, SYNTH_PAN_CENTER, TICKS_PER_QUARTER_NOTE,
+    event_order, read_midi_events,
+)
+
+def assign_voices(events, max_voices):
+    """
+    Simulate the synth's voice allocator ahead of time and tag each event with
+    the voice it should use, so the player can skip the runtime voice search.
+
+    Mirrors Synthesizer::startNote: a retriggered note reuses the voice it is
+    already playing on, otherwise the lowest free voice is taken. When all
+    voices are busy the oldest sounding note is stolen. Note-offs for notes
+    that were stolen (or never started) are dropped; their time is preserved
+    because deltas are computed afterwards from absolute times.
+    Returns (kept_events, stolen_count, dropped_off_count).
+    """
+    voice_note = [None] * max_voices      # note currently on each voice
+    voice_start = [0] * max_voices        # order in which each voice was started
+    note_voice = {}                       # note -> voice currently playing it
+    start_counter = 0
+    stolen = 0
+    dropped = 0
+    kept = []
+
+    for event in events:
+        if event['type'] not in (EVENT_TYPE_NOTE_OFF, EVENT_TYPE_NOTE_ON):
+            kept.append(event)
+            continue
+        note = event['note']
+        if event['type'] == 1:
+            voice = note_voice.get(note)
+            if voice is None:
+                free = [v for v in range(max_voices) if voice_note[v] is None]
+                if free:
+                    voice = free[0]
+                else:
+                    # Steal the voice that has been sounding the longest
+                    voice = min(range(max_voices), key=lambda v: voice_start[v])
+                    del note_voice[voice_note[voice]]
+                    stolen += 1
+            voice_note[voice] = note
+            voice_start[voice] = start_counter
+            start_counter += 1
+            note_voice[note] = voice
+            event['voice'] = voice
+            kept.append(event)
+        else:
+            voice = note_voice.pop(note, None)
+            if voice is None:
+                dropped += 1
+                continue
+            voice_note[voice] = None
+            event['voice'] = voice
+            kept.append(event)
+
+    return kept, stolen, dropped
+
+def analyze_polyphony(events, max_voices):
+    """
+    Run the player's runtime allocator over a song without stealing, exactly
+    like Synthesizer::startNote/stopNote: a retriggered note frees its voice
+    first, otherwise the lowest free voice is used and the note is dropped
+    ("No free voices") when there is none.
+    Returns (peak_polyphony, drops) where drops is a list of (tick, note).
+    peak_polyphony is also the minimum voice count that plays the song without drops.
+    """
+    voice_note = [None] * max_voices
+    note_voice = {}
+    sounding = set()  # Unlimited-voice reference to measure the real demand
+    peak = 0
+    drops = []
+    for event in events:
+        event_type = event['type']
+        note = event['note']
+        if event_type == EVENT_TYPE_NOTE_ON:
+            sounding.add(note)
+            peak = max(peak, len(sounding))
+            voice = note_voice.pop(note, None)
+            if voice is not None:
+                voice_note[voice] = None
+            try:
+                voice = voice_note.index(None)
+            except ValueError:
+                drops.append((event['time'], note))
+                continue
+            voice_note[voice] = note
+            note_voice[note] = voice
+        elif event_type == EVENT_TYPE_NOTE_OFF:
+            sounding.discard(note)
+            voice = note_voice.pop(note, None)
+            if voice is not None:
+                voice_note[voice] = None
+    return peak, drops
+
+def fit_polyphony(events, max_voices, strategy):
+    """
+    Reduce a song so it never needs more than max_voices at once.
+
+    strategy 'velocity': when a note-on would exceed the budget, the quietest
+    of the sounding notes and the new one loses: a new note is dropped, a
+    sounding note is cut short at this tick.
+    strategy 'octave': first drop a new note whose pitch class is already
+    sounding (an octave doubling), then cut the quieter half of an existing
+    doubling, and only then fall back to 'velocity'.
+    Note-offs for notes that are no longer sounding are removed.
+    Returns (events, changed_note_count).
+    """
+    result = []
+    active = {}  # note -> its note-on event
+    changed = 0
+
+    def cut(note, tick):
+        on = active.pop(note)
+        result.append(dict(on, time=tick, type=EVENT_TYPE_NOTE_OFF, velocity=0x40))
+
+    for event in events:
+        event_type = event['type']
+        note = event['note']
+        if event_type == EVENT_TYPE_NOTE_OFF:
+            if active.pop(note, None) is not None:
+                result.append(event)
+            continue
+        if event_type != EVENT_TYPE_NOTE_ON or note in active or len(active) < max_voices:
+            if event_type == EVENT_TYPE_NOTE_ON:
+                active[note] = event
+            result.append(event)
+            continue
+
+        changed += 1
+        if strategy == 'octave':
+            if any(n % 12 == note % 12 for n in active):
+                continue  # Drop the new octave doubling
+            by_class = {}
+            doubled = None
+            for n in active:
+                if n % 12 in by_class:
+                    pair = (by_class[n % 12], n)
+                    doubled = min(pair, key=lambda x: active[x]['velocity'])
+                    break
+                by_class[n % 12] = n
+            if doubled is not None:
+                cut(doubled, event['time'])
+                active[note] = event
+                result.append(event)
+                continue
+
+        quietest = min(active, key=lambda n: active[n]['velocity'])
+        if event['velocity'] <= active[quietest]['velocity']:
+            continue  # The new note is the quietest: drop it
+        cut(quietest, event['time'])
+        active[note] = event
+        result.append(event)
+    return result, changed
+
+def analyze_paths(paths, max_voices, strategy=None):
+    """Print a polyphony report for every .mid file in the given files/directories."""
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            files += sorted(os.path.join(path, f) for f in os.listdir(path) if f.lower().endswith('.mid'))
+        else:
+            files.append(path)
+
+    start = time.perf_counter()
+    over_budget = 0
+    for path in files:
+        try:
+            events = read_midi_events(path)
+        except Exception as e:
+            print(f"{path}: error: {e}")
+            continue
+        peak, drops = analyze_polyphony(events, max_voices)
+        status = "ok" if not drops else f"{len(drops)} notes dropped"
+        print(f"{path}: peak polyphony {peak}, minimum voices {peak}, {max_voices} voices -> {status}")
+        if drops:
+            over_budget += 1
+            print("  drop ticks: " + ", ".join(f"{tick} (note {note})" for tick, note in drops))
+            if strategy:
+                fitted, changed = fit_polyphony(events, max_voices, strategy)
+                fitted_peak, fitted_drops = analyze_polyphony(fitted, max_voices)
+                print(f"  --fit {strategy}: {changed} notes dropped or shortened, peak {fitted_peak}, {len(fitted_drops)} runtime drops")
+    print(f"{len(files)} files analyzed in {time.perf_counter() - start:.2f}s, {over_budget} over the {max_voices}-voice budget")
+
+def peak_event_rate(events):
+    """Most events the player has to handle within a single millisecond, following tempo changes."""
+    tempo_us = DEFAULT_TEMPO_US
+    elapsed_us = 0.0
+    last_tick = 0
+    per_ms = {}
+    for event in events:
+        elapsed_us += (event['time'] - last_tick) * tempo_us / TICKS_PER_QUARTER_NOTE
+        last_tick = event['time']
+        ms = int(elapsed_us // 1000)
+        per_ms[ms] = per_ms.get(ms, 0) + 1
+        if event['type'] == EVENT_TYPE_TEMPO:
+            tempo_us = (event['note'] << 16) | (event['velocity'] << 8) | event['channel']
+    return max(per_ms.values(), default=0)
+
+def coalesce_events(events, grid=1):
+    """
+    Reduce the number of events the player has to process.
+
+    Times are snapped to the nearest multiple of grid ticks (grid 1 leaves them
+    alone); a note that quantization would shorten to nothing keeps one grid
+    step. Each tick is then re-sorted with event_order and cleaned up with the
+    player's note-number semantics: zero-length notes, note-ons duplicating a
+    note already started on the same tick (chord doublings across tracks),
+    note-off/note-on retriggers with an unchanged velocity, note-offs for notes
+    that are not sounding, and tempo and pan events that do not change the
+    tempo or the channel's pan are all dropped.
+    Returns (events, (events_before, events_after, peak_before, peak_after)).
+    """
+    count_before = len(events)
+    peak_before = peak_event_rate(events)
+    if grid > 1:
+        snapped = []
+        started = {}  # note -> (quantized tick, original tick) of its note-on
+        for event in events:
+            tick = (event['time'] + grid // 2) // grid * grid
+            if event['type'] == EVENT_TYPE_NOTE_ON:
+                started[event['note']] = (tick, event['time'])
+            elif event['type'] == EVENT_TYPE_NOTE_OFF:
+                on = started.pop(event['note'], None)
+                if on is not None and tick <= on[0] and event['time'] > on[1]:
+                    tick = on[0] + grid
+            snapped.append(dict(event, time=tick))
+        events = sorted(snapped, key=event_order)
+
+    # Group each tick so offs and ons for the same note can be matched up
+    result = []
+    sounding = {}  # note -> velocity of the note-on that started it
+    tempo_us = DEFAULT_TEMPO_US
+    pans = [SYNTH_PAN_CENTER] * MIDI_CHANNELS  # The player starts every channel centered
+    index = 0
+    while index < len(events):
+        tick = events[index]['time']
+        end = index
+        while end < len(events) and events[end]['time'] == tick:
+            end += 1
+        group = events[index:end]
+        index = end
+
+        ons = {}
+        for event in group:
+            if event['type'] == EVENT_TYPE_NOTE_ON:
+                ons.setdefault(event['note'], event)
+        tempos = [e for e in group if e['type'] == EVENT_TYPE_TEMPO]
+        released = {}  # note -> note-off held back until we know whether it is a retrigger
+        kept = []
+        if tempos:
+            last = tempos[-1]
+            value = (last['note'] << 16) | (last['velocity'] << 8) | last['channel']
+            if value != tempo_us or not result:
+                kept.append(last)
+                tempo_us = value
+        for event in group:
+            note = event['note']
+            if event['type'] == EVENT_TYPE_NOTE_OFF:
+                if note in sounding and note not in released:
+                    released[note] = event
+            elif event['type'] == EVENT_TYPE_NOTE_ON:
+                if ons.get(note) is not event:
+                    continue  # Same note already started on this tick
+                off = released.get(note)
+                if off is not None and sounding[note] == event['velocity']:
+                    released[note] = None  # Retrigger at the same velocity: keep the note sounding
+                    continue
+                kept.append(event)
+            elif event['type'] == EVENT_TYPE_CONTROL:
+                if event['note'] == MIDI_CC_PAN:
+                    if pans[event['channel']] == event['velocity']:
+                        continue
+                    pans[event['channel']] = event['velocity']
+                kept.append(event)
+            elif event['type'] != EVENT_TYPE_TEMPO:
+                kept.append(event)
+        offs = []
+        for note, off in released.items():
+            if off is not None:
+                offs.append(off)
+                del sounding[note]
+        for event in kept:
+            if event['type'] == EVENT_TYPE_NOTE_ON:
+                sounding[event['note']] = event['velocity']
+        result += sorted(offs + kept, key=event_order)
+
+    # Notes started and stopped on the same tick never sound
+    zero_length = set()
+    last_on = {}
+    for position, event in enumerate(result):
+        if event['type'] == EVENT_TYPE_NOTE_ON:
+            last_on[event['note']] = position
+        elif event['type'] == EVENT_TYPE_NOTE_OFF:
+            on = last_on.pop(event['note'], None)
+            if on is not None and result[on]['time'] == event['time']:
+                zero_length.update((on, position))
+    result = [e for position, e in enumerate(result) if position not in zero_length]
+    return result, (count_before, len(result), peak_before, peak_event_rate(result))
@@ -0,0 +1,225 @@
+"""
+Batch song bank: convert a directory of .mid files in parallel, cached by
+content, into one SongBank.h (or songs/*.bin blobs and an .incbin SongBank.S).
+"""
+import re
+import sys
+import time
+import os
+import hashlib
+import json
+from concurrent.futures import ProcessPoolExecutor
+
+from songformat import (
+    SONG_FORMAT_LZ, SONG_FORMAT_RAW, SongFormatError, initial_tempo_us, read_midi_events,
+    song_duration_ms,
+)
+import analyze
+import encode
+import songformat
+from encode import build_song_data, song_definition_lines
+
+BANK_CACHE_DIR = ".songcache"
+
+def bank_song_name(path, used):
+    """C identifier for a song, unique within the bank."""
+    stem = os.path.splitext(os.path.basename(path))[0]
+    name = "SONG_" + (re.sub(r'[^A-Za-z0-9]+', '_', stem).strip('_').upper() or "UNTITLED")
+    unique = name
+    suffix = 2
+    while unique in used:
+        unique = f"{name}_{suffix}"
+        suffix += 1
+    used.add(unique)
+    return unique
+
+def convert_bank_song(path, options):
+    """Convert one .mid file for the bank (runs in a worker process)."""
+    try:
+        events = read_midi_events(path)
+    except Exception as e:
+        raise SongFormatError(f"{path}: {e}")
+    bpm = 60000000 / initial_tempo_us(events)
+    duration_ms = song_duration_ms(events)
+    try:
+        data, event_count, notes = build_song_data(events, options['voices'], options['compress'],
+                                                   options['patterns'], options['fit'], options['coalesce'])
+    except SongFormatError as e:
+        raise SongFormatError(f"{path}: {e}")
+    return {
+        'data': data.hex(),
+        'event_count': event_count,
+        'bpm': bpm,
+        'duration_ms': duration_ms,
+        'notes': notes,
+    }
+
+def bank_cache_key(path, options):
+    """Hash of the file contents, the conversion options and the converter modules' sources."""
+    digest = hashlib.sha256()
+    with open(path, 'rb') as f:
+        digest.update(f.read())
+    digest.update(json.dumps(options, sort_keys=True).encode())
+    for module in (songformat, analyze, encode, sys.modules[__name__]):
+        with open(os.path.abspath(module.__file__), 'rb') as f:
+            digest.update(f.read())
+    return digest.hexdigest()
+
+def build_song_bank(midi_dir, output_path, options, cache_dir=None, jobs=None, binary=False):
+    """
+    Convert every .mid file in midi_dir into one song bank header: song arrays,
+    the song_list index table with titles and durations, and a derived SONG_COUNT.
+    Files are converted in parallel and results are cached by content hash, so
+    re-running on an unchanged library only regenerates the header. With binary
+    set the song bytes go to .bin files instead (see write_binary_bank).
+    """
+    start = time.perf_counter()
+    files = sorted(os.path.join(midi_dir, f) for f in os.listdir(midi_dir) if f.lower().endswith('.mid'))
+    if not files:
+        raise SongFormatError(f"no .mid files in {midi_dir}")
+    if cache_dir is None:
+        cache_dir = os.path.join(os.path.dirname(os.path.abspath(output_path)), BANK_CACHE_DIR)
+    os.makedirs(cache_dir, exist_ok=True)
+
+    results = {}
+    keys = {}
+    pending = []
+    for path in files:
+        keys[path] = bank_cache_key(path, options)
+        cache_file = os.path.join(cache_dir, keys[path] + ".json")
+        if os.path.exists(cache_file):
+            with open(cache_file) as f:
+                results[path] = json.load(f)
+        else:
+            pending.append(path)
+
+    if pending:
+        with ProcessPoolExecutor(max_workers=jobs) as pool:
+            for path, result in zip(pending, pool.map(convert_bank_song, pending, [options] * len(pending))):
+                results[path] = result
+                with open(os.path.join(cache_dir, keys[path] + ".json"), 'w') as f:
+                    json.dump(result, f)
+
+    if binary:
+        written = write_binary_bank(midi_dir, output_path, files, results, options)
+    else:
+        written = write_header_bank(midi_dir, output_path, files, results, options)
+
+    print(f"{len(files)} songs written to {output_path} ({len(pending)} converted, "
+          f"{len(files) - len(pending)} from cache, {written} files changed) "
+          f"in {time.perf_counter() - start:.2f}s")
+
+def write_if_changed(path, content):
+    """
+    Write content only if it differs from what is on disk, so an unchanged
+    song keeps its timestamp and the Arduino build does not recompile it.
+    """
+    mode = 'b' if isinstance(content, bytes) else ''
+    if os.path.exists(path):
+        with open(path, 'r' + mode) as f:
+            if f.read() == content:
+                return False
+    with open(path, 'w' + mode) as f:
+        f.write(content)
+    return True
+
+def bank_entries(files, results):
+    """(name, title, result) for every song in the bank, in song_list order."""
+    used = set()
+    for path in files:
+        name = bank_song_name(path, used)
+        title = os.path.splitext(os.path.basename(path))[0].replace('\\', '\\\\').replace('"', '\\"')
+        yield name, title, results[path]
+
+def song_list_lines(entries, size_expression="sizeof({name}_DATA)"):
+    """
+    The song_list index table and SONG_COUNT closing a song bank header.
+    size_expression gives each song's data size in bytes, which MidiPlayer
+    checks the event count against when the song is loaded.
+    """
+    lines = ["// --- Master Song List (in PROGMEM) ---", "const SongInfo song_list[] PROGMEM = {"]
+    for name, title, result in entries:
+        size = size_expression.format(name=name)
+        lines.append(f"  {{ {name}_DATA, {name}_EVENT_COUNT, {name}_BPM, {name}_FORMAT, \"{title}\", {result['duration_ms']}, {size} }},")
+    lines += ["};", "", "const uint16_t SONG_COUNT = sizeof(song_list) / sizeof(song_list[0]);"]
+    return lines
+
+def write_header_bank(midi_dir, output_path, files, results, options):
+    """Song bank as a single header with every song as a hex array literal."""
+    lines = [
+        f"// Song bank generated by myMidiParse2.py from {midi_dir} -- do not edit",
+        "#ifndef SONG_BANK_H",
+        "#define SONG_BANK_H",
+        "",
+        '#include "SongFormat.h"',
+        "",
+    ]
+    entries = list(bank_entries(files, results))
+    for name, title, result in entries:
+        lines.append(f"// --- {title} ---")
+        lines += song_definition_lines(name, bytes.fromhex(result['data']), result['event_count'],
+                                       result['bpm'], options['compress'], result['notes'])
+        lines.append("")
+    lines += song_list_lines(entries)
+    lines += ["", "#endif // SONG_BANK_H", ""]
+    return int(write_if_changed(output_path, "\n".join(lines)))
+
+def write_binary_bank(midi_dir, output_path, files, results, options):
+    """
+    Song bank as raw blobs: one songs/NAME.bin per song, a SongBank.S that
+    pulls them into flash with .incbin, and a small header of extern symbols,
+    sizes and the song_list table. The compiler never sees the song bytes, so
+    large libraries do not slow the build down, and only changed blobs are
+    rewritten. .incbin paths are relative to the .S file (songs/NAME.bin), so
+    the sketch can be moved or checked in; the assembler looks them up on the
+    include path, so assemble with -I set to the .S file's directory.
+    The data is checked by the converter, as SONG_VALIDATE cannot see it.
+    """
+    out_dir = os.path.dirname(os.path.abspath(output_path))
+    bin_dir = os.path.join(out_dir, "songs")
+    os.makedirs(bin_dir, exist_ok=True)
+    asm_path = os.path.splitext(os.path.abspath(output_path))[0] + ".S"
+    written = 0
+
+    lines = [
+        f"// Song bank generated by myMidiParse2.py from {midi_dir} -- do not edit",
+        f"// Song data is linked from songs/*.bin by {os.path.basename(asm_path)}",
+        "#ifndef SONG_BANK_H",
+        "#define SONG_BANK_H",
+        "",
+        '#include "SongFormat.h"',
+        "",
+    ]
+    asm = [f"/* Song bank data generated by myMidiParse2.py from {midi_dir} -- do not edit */", ""]
+    entries = list(bank_entries(files, results))
+    for name, title, result in entries:
+        data = bytes.fromhex(result['data'])
+        bin_path = os.path.join(bin_dir, name + ".bin")
+        written += write_if_changed(bin_path, data)
+
+        lines.append(f"// --- {title} ---")
+        lines += [f"// {note}" for note in result['notes']]
+        lines.append(f'extern "C" const uint8_t {name}_DATA[];')
+        lines.append(f"const uint32_t {name}_SIZE = {len(data)};")
+        lines.append(f"const uint32_t {name}_EVENT_COUNT = {result['event_count']};")
+        lines.append(f"const uint8_t {name}_FORMAT = {'SONG_FORMAT_LZ' if options['compress'] else 'SONG_FORMAT_RAW'};")
+        lines.append(f"const float {name}_BPM = {result['bpm']:.2f}f;")
+        lines.append("")
+
+        # One section per song so --gc-sections drops songs the sketch never references
+        asm += [
+            f'    .section .rodata.songbank.{name},"a"',
+            f"    .global {name}_DATA",
+            f"    .type {name}_DATA, @object",
+            "    .balign 4",
+            f"{name}_DATA:",
+            f'    .incbin "songs/{name}.bin"',
+            f"    .size {name}_DATA, . - {name}_DATA",
+            "",
+        ]
+
+    lines += song_list_lines(entries, "{name}_SIZE") # sizeof() cannot see the extern arrays
+    lines += ["", "#endif // SONG_BANK_H", ""]
+    written += write_if_changed(output_path, "\n".join(lines))
+    written += write_if_changed(asm_path, "\n".join(asm))
+    return written
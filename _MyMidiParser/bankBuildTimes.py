@@ -0,0 +1,140 @@
+"""
+Build times of a large song library as a hex-array SongBank.h against the --bin
+bank (SongBank.S with .incbin plus songs/*.bin), each from scratch and after
+editing one song. Every build converts with build_song_bank and then compiles a
+host translation unit that uses song_list (and assembles SongBank.S for --bin),
+rebuilding only outputs older than their inputs, as make or the Arduino IDE
+would. Prints the four times, split into convert and compile.
+
+    python bankBuildTimes.py [--songs 100] [--cxx c++]
+"""
+import argparse
+import contextlib
+import io
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+import mido
+
+from bank import build_song_bank
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SKETCH_DIR = os.path.join(HERE, "..", "ESP32_I2S_SquareWave_Midi_Synth")
+STUBS_DIR = os.path.join(HERE, "..", "host", "stubs")
+OPTIONS = {'voices': 8, 'compress': False, 'patterns': False, 'fit': None, 'coalesce': None}
+LIBRARY_SOURCES = ("La Bamba4.mid", "StrobeCombined.mid", "TetrisA.mid", "TetrisPianoFinale1.mid")
+
+# Stands in for the sketch: reads every song so none of the data can be dropped
+SKETCH_SOURCE = """\
+#include <Arduino.h>
+#include "SongBank.h"
+
+int main() {
+    unsigned long sum = 0;
+    for (uint16_t i = 0; i < SONG_COUNT; ++i) {
+        sum += song_list[i].event_count + song_list[i].midi_data_ptr[song_list[i].data_size - 1];
+    }
+    return (int)(sum & 1);
+}
+"""
+
+def song_path(midi_dir, i):
+    return os.path.join(midi_dir, f"song{i:03d}.mid")
+
+def make_song_library(midi_dir, count):
+    """Write count copies of the bundled example songs, each with its own track name."""
+    os.makedirs(midi_dir, exist_ok=True)
+    for i in range(count):
+        # A distinct track name per copy, so every song has its own cache entry
+        mid = mido.MidiFile(os.path.join(HERE, LIBRARY_SOURCES[i % len(LIBRARY_SOURCES)]))
+        mid.tracks[0].insert(0, mido.MetaMessage('track_name', name=f"song {i}"))
+        mid.save(song_path(midi_dir, i))
+
+def transpose_first_note(path):
+    """Edit one song: its first note goes up a semitone."""
+    mid = mido.MidiFile(path)
+    first = next(msg for track in mid.tracks for msg in track if msg.type == 'note_on' and msg.velocity > 0)
+    first.note += 1
+    mid.save(path)
+
+def convert(midi_dir, output_path, binary, jobs=None):
+    """Run build_song_bank and return its report line."""
+    report = io.StringIO()
+    with contextlib.redirect_stdout(report):
+        build_song_bank(midi_dir, output_path, OPTIONS, jobs=jobs, binary=binary)
+    return report.getvalue()
+
+def out_of_date(output, inputs):
+    if not os.path.exists(output):
+        return True
+    built = os.path.getmtime(output)
+    return any(os.path.getmtime(path) > built for path in inputs)
+
+def compile_bank(cxx, bank_dir, binary):
+    """Compile (and for --bin assemble) what changed and link. Returns the seconds spent."""
+    sketch = os.path.join(bank_dir, "sketch.cpp")
+    header = os.path.join(bank_dir, "SongBank.h")
+    objects = [os.path.join(bank_dir, "sketch.o")]
+    start = time.perf_counter()
+    if out_of_date(objects[0], [sketch, header]):
+        subprocess.run([cxx, "-c", sketch, "-I", bank_dir, "-I", SKETCH_DIR, "-I", STUBS_DIR, "-o", objects[0]],
+                       check=True)
+    if binary:
+        asm = os.path.join(bank_dir, "SongBank.S")
+        songs_dir = os.path.join(bank_dir, "songs")
+        blobs = [os.path.join(songs_dir, name) for name in os.listdir(songs_dir)]
+        objects.append(os.path.join(bank_dir, "SongBank.o"))
+        if out_of_date(objects[1], [asm] + blobs):
+            subprocess.run([cxx, "-c", asm, "-I", bank_dir, "-Wa,--noexecstack", "-o", objects[1]], check=True)
+    subprocess.run([cxx] + objects + ["-o", os.path.join(bank_dir, "sketch")], check=True)
+    return time.perf_counter() - start
+
+def timed_build(cxx, midi_dir, bank_dir, binary):
+    """(convert seconds, compile seconds) for one build of the bank in bank_dir."""
+    start = time.perf_counter()
+    convert(midi_dir, os.path.join(bank_dir, "SongBank.h"), binary)
+    convert_time = time.perf_counter() - start
+    return convert_time, compile_bank(cxx, bank_dir, binary)
+
+def measure(cxx, song_count, work_dir):
+    """Rows of (bank, build, convert seconds, compile seconds) for both banks."""
+    rows = []
+    for binary in (False, True):
+        midi_dir = os.path.join(work_dir, "midi")
+        shutil.rmtree(midi_dir, ignore_errors=True)
+        make_song_library(midi_dir, song_count)
+        bank_dir = os.path.join(work_dir, "bin" if binary else "header")
+        os.makedirs(bank_dir)
+        with open(os.path.join(bank_dir, "sketch.cpp"), 'w') as f:
+            f.write(SKETCH_SOURCE)
+        name = "--bin SongBank.S" if binary else "hex SongBank.h"
+        rows.append((name, "full") + timed_build(cxx, midi_dir, bank_dir, binary))
+        time.sleep(0.01) # Keep the edited files' mtimes apart from the first build's
+        transpose_first_note(song_path(midi_dir, song_count // 2))
+        rows.append((name, "one song changed") + timed_build(cxx, midi_dir, bank_dir, binary))
+    return rows
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Compare full and incremental build times of a hex and a --bin song bank")
+    parser.add_argument("--songs", type=int, default=100, help="songs in the library (default 100)")
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"), help="C++ compiler (default $CXX or c++)")
+    args = parser.parse_args()
+    if args.songs < 1:
+        parser.error("--songs must be at least 1")
+    if shutil.which(args.cxx) is None:
+        print(f"Error: compiler {args.cxx} not found", file=sys.stderr)
+        sys.exit(1)
+
+    work_dir = tempfile.mkdtemp()
+    try:
+        rows = measure(args.cxx, args.songs, work_dir)
+    finally:
+        shutil.rmtree(work_dir)
+    print(f"{args.songs} songs, {args.cxx}")
+    print(f"{'bank':<18} {'build':<17} {'convert':>8} {'compile':>8} {'total':>8}")
+    for name, build, convert_time, compile_time in rows:
+        print(f"{name:<18} {build:<17} {convert_time:>7.2f}s {compile_time:>7.2f}s {convert_time + compile_time:>7.2f}s")
@@ -0,0 +1,449 @@
+"""
+Encoding events into the player's byte stream (long deltas, LZ compression,
+repeat patterns) and the generated C arrays and song headers.
+"""
+import sys
+import re
+import time
+import os
+
+from songformat import (
+    BYTES_PER_EVENT, DEFAULT_MAX_VOICES, EVENT_TYPE_LONG_DELTA, EVENT_TYPE_REPEAT,
+    LZ_MAX_LITERAL_RUN, LZ_MAX_MATCH, LZ_MIN_MATCH, LZ_WINDOW_SIZE, MAX_EVENT_COUNT,
+    MAX_LONG_DELTA, MAX_REPEAT_COUNT, MAX_REPEAT_DEPTH, MAX_REPEAT_FIELD, MAX_SHORT_DELTA,
+    MIN_REPEAT_EVENTS, SONG_FORMAT_LZ, SONG_FORMAT_RAW, SongFormatError, TICKS_PER_QUARTER_NOTE,
+    VOICE_SHIFT, initial_tempo_us, read_midi_events, validate_song_data,
+)
+from analyze import assign_voices, coalesce_events, fit_polyphony
+
+def split_long_deltas(events):
+    """
+    Replace deltas that do not fit in 16 bits with an EVENT_TYPE_LONG_DELTA
+    carrier event followed by the original event at delta 0.
+    Raises SongFormatError instead of truncating anything.
+    """
+    result = []
+    for event in events:
+        delta = event['delta']
+        if delta > MAX_LONG_DELTA:
+            raise SongFormatError(f"delta of {delta} ticks at tick {event['time']} exceeds 32 bits")
+        if delta > MAX_SHORT_DELTA:
+            result.append({
+                'time': event['time'],
+                'delta': delta,
+                'type': EVENT_TYPE_LONG_DELTA,
+                'note': (delta >> 24) & 0xFF,
+                'velocity': (delta >> 16) & 0xFF,
+                'channel': 0
+            })
+            event = dict(event, delta=0)
+        result.append(event)
+    if len(result) > MAX_EVENT_COUNT:
+        raise SongFormatError(f"{len(result)} events exceed the player's 32-bit event index")
+    return result
+
+def encode_events(events):
+    """Pack events into the player's 6-byte-per-event layout."""
+    data = bytearray()
+    for event in events:
+        # Split the low 16 bits of delta time into two separate bytes
+        # (longer deltas were moved into EVENT_TYPE_LONG_DELTA carriers)
+        delta_high = (event['delta'] >> 8) & 0xFF  # High byte
+        delta_low = event['delta'] & 0xFF          # Low byte
+
+        # Voice index (if assigned) goes in the high nibble of the type byte
+        type_byte = event['type']
+        if 'voice' in event:
+            type_byte |= (event['voice'] + 1) << VOICE_SHIFT
+
+        # Format as: high byte, low byte, type, note, velocity, channel
+        data += bytes([delta_high, delta_low, type_byte, event['note'], event['velocity'], event['channel']])
+    return bytes(data)
+
+def format_byte_array(data):
+    """Format bytes as a C initializer list."""
+    return "{" + ", ".join(f"0x{b:02x}" for b in data) + "}"
+
+def lz_compress(data):
+    """
+    Greedy LZ compression into the LzStreamDecoder format:
+    literal runs (token 0x00-0x7F) and back-references of up to
+    LZ_MAX_MATCH bytes within the last LZ_WINDOW_SIZE bytes.
+    """
+    out = bytearray()
+    literals = bytearray()
+    positions = {}  # 3-byte prefix -> positions where it occurs
+
+    def flush_literals():
+        for start in range(0, len(literals), LZ_MAX_LITERAL_RUN):
+            run = literals[start:start + LZ_MAX_LITERAL_RUN]
+            out.append(len(run) - 1)
+            out.extend(run)
+        literals.clear()
+
+    def remember(pos):
+        if pos + LZ_MIN_MATCH <= len(data):
+            positions.setdefault(data[pos:pos + LZ_MIN_MATCH], []).append(pos)
+
+    i = 0
+    while i < len(data):
+        best_len, best_dist = 0, 0
+        for candidate in reversed(positions.get(data[i:i + LZ_MIN_MATCH], [])):
+            dist = i - candidate
+            if dist > LZ_WINDOW_SIZE:
+                break
+            length = 0
+            # Overlapping matches are fine, the decoder copies byte by byte
+            while (length < LZ_MAX_MATCH and i + length < len(data)
+                   and data[candidate + length] == data[i + length]):
+                length += 1
+            if length > best_len:
+                best_len, best_dist = length, dist
+        if best_len >= LZ_MIN_MATCH:
+            flush_literals()
+            out.append(0x80 | (best_len - LZ_MIN_MATCH))
+            out.append(best_dist - 1)
+            for pos in range(i, i + best_len):
+                remember(pos)
+            i += best_len
+        else:
+            literals.append(data[i])
+            remember(i)
+            i += 1
+    flush_literals()
+    return bytes(out)
+
+def lz_decompress(data, size):
+    """Reference decoder, mirrors LzStreamDecoder::nextByte (including the ring window)."""
+    window = bytearray(LZ_WINDOW_SIZE)
+    out = bytearray()
+    src = 0
+    while len(out) < size:
+        token = data[src]
+        src += 1
+        if token & 0x80:
+            pos = (len(out) - data[src] - 1) % LZ_WINDOW_SIZE
+            src += 1
+            for _ in range((token & 0x7F) + LZ_MIN_MATCH):
+                value = window[pos]
+                window[len(out) % LZ_WINDOW_SIZE] = value
+                out.append(value)
+                pos = (pos + 1) % LZ_WINDOW_SIZE
+        else:
+            for _ in range(token + 1):
+                value = data[src]
+                src += 1
+                window[len(out) % LZ_WINDOW_SIZE] = value
+                out.append(value)
+    return bytes(out[:size])
+
+def compression_stats(data):
+    """
+    Compress, verify the round trip and measure the Python reference decoder's
+    speed. That rate is the converter's only: the device's LzStreamDecoder is
+    timed by the host synth_benchmark ("song" lines of the LZ bank).
+    """
+    packed = lz_compress(data)
+    start = time.perf_counter()
+    unpacked = lz_decompress(packed, len(data))
+    elapsed = time.perf_counter() - start
+    if unpacked != data:
+        raise SongFormatError("LZ round trip mismatch")
+    events = len(data) // BYTES_PER_EVENT
+    return packed, len(data) / len(packed), events / elapsed if elapsed > 0 else float('inf')
+
+def encode_repeat(distance, length, count):
+    """Build an EVENT_TYPE_REPEAT record (length in the delta bytes, distance in note/velocity)."""
+    return bytes([length >> 8, length & 0xFF, EVENT_TYPE_REPEAT, distance >> 8, distance & 0xFF, count])
+
+def find_patterns(data):
+    """
+    Replace repeated event ranges with EVENT_TYPE_REPEAT records.
+
+    Works greedily left to right: at each input event, look for an earlier
+    range of output records whose expansion matches the upcoming events,
+    then count how many times it repeats back to back. Ranges may contain
+    repeat records themselves, up to MAX_REPEAT_DEPTH levels of nesting.
+    Returns the new record stream; the result is verified against the input.
+    """
+    events = [data[i:i + BYTES_PER_EVENT] for i in range(0, len(data), BYTES_PER_EVENT)]
+    records = []       # output records (bytes)
+    expansions = []    # events each output record plays
+    depths = []        # repeat nesting depth of each output record
+    starts_with = {}   # first expanded event -> output indices whose expansion begins with it
+
+    def emit(record, expansion, depth):
+        starts_with.setdefault(expansion[0], []).append(len(records))
+        records.append(record)
+        expansions.append(expansion)
+        depths.append(depth)
+
+    i = 0
+    while i < len(events):
+        best = None  # (covered events, start, length, span, count, depth)
+        for start in starts_with.get(events[i], []):
+            span = 0
+            length = 0
+            depth = 0
+            best_for_start = None
+            for k in range(start, len(records)):
+                expansion = expansions[k]
+                if events[i + span:i + span + len(expansion)] != expansion:
+                    break
+                span += len(expansion)
+                length += 1
+                depth = max(depth, depths[k])
+                if span >= MIN_REPEAT_EVENTS and depth < MAX_REPEAT_DEPTH:
+                    best_for_start = (span, length, depth)
+            if best_for_start is None:
+                continue
+            span, length, depth = best_for_start
+            distance = len(records) - start
+            if length > MAX_REPEAT_FIELD or distance > MAX_REPEAT_FIELD:
+                continue
+            # Count back-to-back repetitions of the same range
+            body = events[i:i + span]
+            count = 1
+            while count < MAX_REPEAT_COUNT and events[i + count * span:i + (count + 1) * span] == body:
+                count += 1
+            if best is None or span * count > best[0]:
+                best = (span * count, start, length, span, count, depth)
+
+        if best is None:
+            emit(events[i], [events[i]], 0)
+            i += 1
+            continue
+
+        covered, start, length, span, count, depth = best
+        expansion = [e for k in range(start, start + length) for e in expansions[k]] * count
+        emit(encode_repeat(len(records) - start, length, count), expansion, depth + 1)
+        i += covered
+
+    result = b"".join(records)
+    if b"".join(expand_patterns(result)) != data:
+        raise SongFormatError("pattern expansion does not reproduce the original event stream")
+    return result
+
+def expand_patterns(data):
+    """Reference expansion of repeat records, mirrors MidiPlayer::fetchEvent."""
+    records = [data[i:i + BYTES_PER_EVENT] for i in range(0, len(data), BYTES_PER_EVENT)]
+    stack = []  # [start, end, return_index, remaining]
+    index = 0
+    out = []
+    while True:
+        while stack and index == stack[-1][1]:
+            stack[-1][3] -= 1
+            if stack[-1][3] > 0:
+                index = stack[-1][0]
+            else:
+                index = stack.pop()[2]
+        if index >= len(records):
+            return out
+        record = records[index]
+        if record[2] & 0x0F != EVENT_TYPE_REPEAT:
+            out.append(record)
+            index += 1
+            continue
+        length = (record[0] << 8) | record[1]
+        distance = (record[3] << 8) | record[4]
+        if len(stack) >= MAX_REPEAT_DEPTH:
+            raise SongFormatError(f"repeat nesting deeper than {MAX_REPEAT_DEPTH} at record {index}")
+        stack.append([index - distance, index - distance + length, index + 1, record[5]])
+        index -= distance
+
+def read_song_header(song_data_path):
+    """
+    Read the songs of a SongData.h or generated SongBank.h, in song_list order.
+    Song data comes from the byte arrays, or from songs/NAME.bin next to the
+    header for banks written with --bin. Returns a list of dicts with title,
+    data, event_count, bpm and format.
+    """
+    with open(song_data_path) as f:
+        text = f.read()
+    arrays = {}
+    for match in re.finditer(r'(?:constexpr|const) uint8_t (\w+)\[\] PROGMEM = \{(.*?)\};', text, re.S):
+        arrays[match.group(1)] = bytes(int(b, 16) for b in re.findall(r'0x[0-9a-fA-F]{2}', match.group(2)))
+    bin_dir = os.path.join(os.path.dirname(os.path.abspath(song_data_path)), "songs")
+    for name in re.findall(r'extern "C" const uint8_t (\w+)_DATA\[\];', text):
+        with open(os.path.join(bin_dir, name + ".bin"), 'rb') as f:
+            arrays[name + "_DATA"] = f.read()
+    constants = dict(re.findall(r'const (?:uint\w+|float) (\w+) = ([^;]+);', text))
+
+    def value(token):
+        token = token.strip()
+        if token in constants:
+            return value(constants[token])
+        if token in ("SONG_FORMAT_RAW", "SONG_FORMAT_LZ"):
+            return SONG_FORMAT_LZ if token == "SONG_FORMAT_LZ" else SONG_FORMAT_RAW
+        count = re.match(r'SONG_EVENT_COUNT\((\w+)\)', token)
+        if count:
+            return len(arrays[count.group(1)]) // BYTES_PER_EVENT
+        return float(token.rstrip('fFuUlL'))
+
+    songs = []
+    table = re.search(r'song_list\[\] PROGMEM = \{(.*?)\n\};', text, re.S)
+    if table is None:
+        raise SongFormatError(f"{song_data_path}: no song_list found")
+    entry = r'\{\s*(\w+)\s*,\s*([^,]+),\s*([^,]+),\s*([^,]+),\s*"((?:[^"\\]|\\.)*)"'
+    for match in re.finditer(entry, table.group(1)):
+        if match.group(1) not in arrays:
+            raise SongFormatError(f"{song_data_path}: no data for {match.group(1)}")
+        songs.append({
+            'title': match.group(5).replace('\\"', '"').replace('\\\\', '\\'),
+            'data': arrays[match.group(1)],
+            'event_count': int(value(match.group(2))),
+            'bpm': value(match.group(3)),
+            'format': int(value(match.group(4))),
+        })
+    return songs
+
+def report_song_bank_compression(song_data_path):
+    """
+    Print compressed and pattern-encoded sizes for every raw song in a SongData.h.
+    The decode rate is the Python reference decoder's, not the device's; see
+    synth_benchmark for LzStreamDecoder.
+    """
+    print(f"{'song':<20} {'events':>7} {'raw':>7} {'lz':>7} {'ratio':>6} {'py dec ev/s':>12} {'patterns':>9}")
+    for song in read_song_header(song_data_path):
+        data = song['data']
+        if song['format'] != SONG_FORMAT_RAW:
+            continue
+        packed, ratio, rate = compression_stats(data)
+        patterned = find_patterns(data)
+        print(f"{song['title'][:20]:<20} {len(data) // BYTES_PER_EVENT:>7} {len(data):>7} {len(packed):>7} {ratio:>6.2f} {rate:>12.0f} {len(patterned):>9}")
+
+def build_song_data(events, max_voices=None, compress=False, patterns=False, fit=None, coalesce=None):
+    """
+    Turn absolute-time events into the player's byte stream.
+    If coalesce is set, events are first quantized to that grid and cleaned up
+    with coalesce_events.
+    If fit is set, the song is then reduced to the voice budget with fit_polyphony.
+    Returns (data, event_count, comment_lines).
+    """
+    notes = []
+    
+    if coalesce is not None:
+        events, (count_before, count_after, peak_before, peak_after) = coalesce_events(events, coalesce)
+        notes.append(f"Coalesced (grid {coalesce} ticks): {count_before} -> {count_after} events, "
+                     f"peak {peak_before} -> {peak_after} events/ms")
+    
+    if fit is not None:
+        budget = max_voices if max_voices is not None else DEFAULT_MAX_VOICES
+        events, changed = fit_polyphony(events, budget, fit)
+        notes.append(f"Fitted to {budget} voices ({fit}): {changed} notes dropped or shortened")
+    
+    # Optionally pre-allocate voices (must run on absolute times, before deltas)
+    if max_voices is not None:
+        events, stolen, dropped = assign_voices(events, max_voices)
+        notes.append(f"event_type high nibble: voice index + 1, pre-allocated for {max_voices} voices")
+        notes.append(f"({stolen} notes stolen, {dropped} stale note-offs removed)")
+
+    # Convert to delta time (time between events)
+    last_time = 0
+    for event in events:
+        delta = event['time'] - last_time
+        last_time = event['time']
+        event['delta'] = delta
+
+    events = split_long_deltas(events)
+    data = encode_events(events)
+    data, event_count, more_notes = pack_song_data(data, compress, patterns)
+    return data, event_count, notes + more_notes
+
+def pack_song_data(data, compress=False, patterns=False):
+    """Apply the optional pattern and compression passes to a raw event stream."""
+    validate_song_data(data)
+    notes = []
+    if patterns:
+        raw_size = len(data)
+        data = find_patterns(data)
+        notes.append("event_type 3 = repeat (length in delta bytes, distance back in note/velocity, count in channel)")
+        notes.append(f"Repeat records: {raw_size} -> {len(data)} bytes, expansion verified")
+    event_count = len(data) // BYTES_PER_EVENT
+    if compress:
+        raw_size = len(data)
+        data, ratio, rate = compression_stats(data)
+        notes.append(f"LZ compressed (SONG_FORMAT_LZ): {raw_size} -> {len(data)} bytes, ratio {ratio:.2f}")
+        notes.append(f"Python reference decoder (converter side only): {rate:.0f} events/sec")
+    return data, event_count, notes
+
+def parse_midi_to_arduino_array(midi_file_path, max_voices=None, compress=False, patterns=False, fit=None, coalesce=None):
+    """
+    Parse a MIDI file and output a C-style array initialization
+    that can be copied directly into Arduino code.
+    If max_voices is given, a voice index is baked into every event.
+    If compress is set, the event stream is LZ-compressed (SONG_FORMAT_LZ).
+    If patterns is set, repeated ranges are replaced with repeat records.
+    """
+    try:
+        events = read_midi_events(midi_file_path)
+    except Exception as e:
+        print(f"Error opening MIDI file: {e}")
+        return
+    
+    try:
+        data, event_count, notes = build_song_data(events, max_voices, compress, patterns, fit, coalesce)
+    except SongFormatError as e:
+        print(f"Error: {e}", file=sys.stderr)
+        sys.exit(1)
+    array_data = format_byte_array(data)
+    
+    # Print the array declaration header
+    print(f"// MIDI data from {midi_file_path}")
+    print(f"// Format: delta_time_high(8bit), delta_time_low(8bit), event_type(8bit), note(8bit), velocity(8bit), channel(8bit)")
+    print(f"// event_type: 0 = note off, 1 = note on, 2 = long delta (delta bits 31-16 in note/velocity), 4 = tempo (us/quarter)")
+    print(f"// Ticks rescaled to {TICKS_PER_QUARTER_NOTE} per quarter note; initial tempo {60000000 / initial_tempo_us(events):.2f} BPM (use as BPM_x)")
+    for note in notes:
+        print(f"// {note}")
+    print(f"const uint8_t MIDI_DATA[] PROGMEM = {array_data};")
+    print(f"const uint32_t MIDI_EVENT_COUNT = {event_count};")
+    print(f"const uint8_t MIDI_BYTES_PER_EVENT = 6;  // Now 6 bytes per event")
+    if compress or patterns:
+        # The random-access helper below only works on flat raw data
+        return
+    
+    # Print helper function for accessing the data
+    print("""
+// Helper function to read an event from PROGMEM
+void readMidiEvent(uint32_t index, uint16_t &delta, uint8_t &type, uint8_t &note, uint8_t &velocity, uint8_t &channel) {
+  uint32_t pos = index * MIDI_BYTES_PER_EVENT;
+  // Combine the two delta time bytes
+  delta = (pgm_read_byte(&MIDI_DATA[pos]) << 8) | pgm_read_byte(&MIDI_DATA[pos + 1]);
+  type = pgm_read_byte(&MIDI_DATA[pos + 2]);
+  note = pgm_read_byte(&MIDI_DATA[pos + 3]);
+  velocity = pgm_read_byte(&MIDI_DATA[pos + 4]);
+  channel = pgm_read_byte(&MIDI_DATA[pos + 5]);
+}
+""")
+
+def song_definition_lines(name, data, event_count, bpm, compress, notes):
+    """C++ definitions of one song: NAME_DATA, NAME_EVENT_COUNT, NAME_FORMAT and NAME_BPM."""
+    lines = [f"// {note}" for note in notes]
+    lines.append(f"constexpr uint8_t {name}_DATA[] PROGMEM = {format_byte_array(data)};")
+    if compress:
+        # Compressed size says nothing about the event count, so it is recorded explicitly
+        lines.append(f"const uint32_t {name}_EVENT_COUNT = {event_count};")
+        lines.append(f"const uint8_t {name}_FORMAT = SONG_FORMAT_LZ;")
+    else:
+        lines.append(f"const uint32_t {name}_EVENT_COUNT = SONG_EVENT_COUNT({name}_DATA);")
+        lines.append(f"const uint8_t {name}_FORMAT = SONG_FORMAT_RAW;")
+        lines.append(f"SONG_VALIDATE({name}_DATA);")
+    lines.append(f"const float {name}_BPM = {bpm:.2f}f;")
+    return lines
+
+def generate_song_header(name, source_path, data, event_count, bpm, compress, notes):
+    """
+    Build a self-contained song header for the sketch. Event count is derived
+    from the array itself and SONG_VALIDATE checks the data at compile time.
+    """
+    lines = [
+        f"// Generated by myMidiParse2.py from {source_path} -- do not edit",
+        f"#ifndef SONG_{name}_H",
+        f"#define SONG_{name}_H",
+        "",
+        '#include "SongFormat.h"',
+        "",
+    ]
+    lines += song_definition_lines(name, data, event_count, bpm, compress, notes)
+    lines += ["", f"#endif // SONG_{name}_H", ""]
+    return "\n".join(lines)
@@ -1,94 +1,124 @@
-import mido
+"""
+Command line for the song converter: one .mid file to a paste-in array or a song
+header, a whole directory to a song bank, and polyphony and compression reports.
+The work is done in songformat.py, analyze.py, encode.py and bank.py.
+"""
 import sys
+import argparse
 
-def parse_midi_to_arduino_array(midi_file_path):
-    """
-    Parse a MIDI file and output a C-style array initialization
-    that can be copied directly into Arduino code.
-    """
-    try:
-        mid = mido.MidiFile(midi_file_path)
-    except Exception as e:
-        print(f"Error opening MIDI file: {e}")
-        return
-    
-    # Structure to hold our parsed events
-    events = []
-    
-    # Process all tracks
-    for track in mid.tracks:
-        track_time = 0
-        for msg in track:
-            # Update track time
-            track_time += msg.time
-            
-            # Only process note_on and note_off events
-            if msg.type == 'note_on' or msg.type == 'note_off':
-                # event_type: 0 = note off, 1 = note on
-                event_type = 1 if msg.type == 'note_on' and msg.velocity > 0 else 0
-                
-                # Store event with absolute time
-                events.append({
-                    'time': track_time,
-                    'type': event_type,
-                    'note': msg.note,
-                    'velocity': msg.velocity,
-                    'channel': msg.channel
-                })
-    
-    # Sort events by time
-    events.sort(key=lambda x: x['time'])
-    
-    # Convert to delta time (time between events)
-    last_time = 0
-    for event in events:
-        delta = event['time'] - last_time
-        last_time = event['time']
-        event['delta'] = delta
-    
-    # Generate array data
-    array_data = "{"
-    
-    # Add all events with delta time split into two bytes
-    for i, event in enumerate(events):
-        if i > 0:
-            array_data += ", "
-        
-        # Split 16-bit delta time into two separate bytes
-        delta_high = (event['delta'] >> 8) & 0xFF  # High byte
-        delta_low = event['delta'] & 0xFF          # Low byte
-        
-        # Format as: high byte, low byte, type, note, velocity, channel
-        array_data += f"0x{delta_high:02x}, 0x{delta_low:02x}, 0x{event['type']:02x}, 0x{event['note']:02x}, 0x{event['velocity']:02x}, 0x{event['channel']:02x}"
-    
-    array_data += "}"
-    
-    # Print the array declaration header
-    print(f"// MIDI data from {midi_file_path}")
-    print(f"// Format: delta_time_high(8bit), delta_time_low(8bit), event_type(8bit), note(8bit), velocity(8bit), channel(8bit)")
-    print(f"// event_type: 0 = note off, 1 = note on")
-    print(f"const uint8_t MIDI_DATA[] PROGMEM = {array_data};")
-    print(f"const uint16_t MIDI_EVENT_COUNT = {len(events)};")
-    print(f"const uint8_t MIDI_BYTES_PER_EVENT = 6;  // Now 6 bytes per event")
-    
-    # Print helper function for accessing the data
-    print("""
-// Helper function to read an event from PROGMEM
-void readMidiEvent(uint16_t index, uint16_t &delta, uint8_t &type, uint8_t &note, uint8_t &velocity, uint8_t &channel) {
-  uint16_t pos = index * MIDI_BYTES_PER_EVENT;
-  // Combine the two delta time bytes
-  delta = (pgm_read_byte(&MIDI_DATA[pos]) << 8) | pgm_read_byte(&MIDI_DATA[pos + 1]);
-  type = pgm_read_byte(&MIDI_DATA[pos + 2]);
-  note = pgm_read_byte(&MIDI_DATA[pos + 3]);
-  velocity = pgm_read_byte(&MIDI_DATA[pos + 4]);
-  channel = pgm_read_byte(&MIDI_DATA[pos + 5]);
-}
-""")
+from songformat import (
+    DEFAULT_MAX_VOICES, DEFAULT_TEMPO_US, MAX_ENCODABLE_VOICES, TICKS_PER_QUARTER_NOTE, SongFormatError,
+    initial_tempo_us, read_binary_song, read_midi_events,
+)
+from analyze import analyze_paths
+from encode import (
+    build_song_data, generate_song_header, pack_song_data, parse_midi_to_arduino_array,
+    report_song_bank_compression,
+)
+from bank import BANK_CACHE_DIR, build_song_bank
 
 if __name__ == "__main__":
-    if len(sys.argv) != 2:
-        print("Usage: python myMidiParse.py <midi_file>")
+    parser = argparse.ArgumentParser(description="Convert a MIDI file into a SongData.h byte array")
+    parser.add_argument("midi_file", nargs="?", help=".mid file, or .bin raw event stream with --header")
+    parser.add_argument("--voices", type=int, nargs="?", const=DEFAULT_MAX_VOICES, default=None,
+                        help=f"pre-allocate voices for this many synth voices (default {DEFAULT_MAX_VOICES})")
+    parser.add_argument("--compress", action="store_true",
+                        help="LZ-compress the event stream (use SONG_FORMAT_LZ in song_list)")
+    parser.add_argument("--patterns", action="store_true",
+                        help="replace repeated event ranges with repeat records (raw songs only)")
+    parser.add_argument("--compression-report", metavar="SONG_DATA_H",
+                        help="report compression ratio and Python decode rate for every song in a SongData.h")
+    parser.add_argument("--header", metavar="NAME",
+                        help="write a validated song header (NAME_DATA, NAME_EVENT_COUNT, ...) instead of the paste-in array")
+    parser.add_argument("--bpm", type=float, default=None,
+                        help="BPM recorded in the generated header (default: the file's initial tempo)")
+    parser.add_argument("-o", "--output", help="output file for --header (default: stdout)")
+    parser.add_argument("--raw-output", metavar="FILE",
+                        help="write the .mid's raw event stream to FILE (for the host synth_render) and print "
+                             "its event count and tempo")
+    parser.add_argument("--analyze", nargs="+", metavar="PATH",
+                        help="report peak polyphony and note drops for .mid files or directories of them")
+    parser.add_argument("--bank", metavar="MIDI_DIR",
+                        help="convert every .mid in MIDI_DIR into a complete song bank header (-o, default SongBank.h)")
+    parser.add_argument("--bin", action="store_true",
+                        help="with --bank, write songs/*.bin and an .incbin SongBank.S instead of hex arrays")
+    parser.add_argument("--cache-dir", help=f"song bank cache (default: {BANK_CACHE_DIR} next to the output)")
+    parser.add_argument("-j", "--jobs", type=int, default=None, help="parallel conversions for --bank (default: CPU count)")
+    parser.add_argument("--fit", choices=["velocity", "octave"],
+                        help="reduce the song to the voice budget (--voices, default %d)" % DEFAULT_MAX_VOICES)
+    parser.add_argument("--coalesce", type=int, nargs="?", const=1, default=None, metavar="GRID",
+                        help="quantize to GRID ticks (%d per quarter note, default 1 = no quantization) "
+                             "and drop redundant events" % TICKS_PER_QUARTER_NOTE)
+    args = parser.parse_args()
+    if args.coalesce is not None and args.coalesce < 1:
+        parser.error("--coalesce grid must be at least 1 tick")
+    if args.voices is not None and not 1 <= args.voices <= MAX_ENCODABLE_VOICES:
+        # Checked before any mode runs: the voice index has to fit the event type's high nibble
+        parser.error(f"--voices must be between 1 and {MAX_ENCODABLE_VOICES}")
+
+    if args.compression_report:
+        report_song_bank_compression(args.compression_report)
+        sys.exit(0)
+    if args.analyze:
+        analyze_paths(args.analyze, args.voices or DEFAULT_MAX_VOICES, args.fit)
+        sys.exit(0)
+    if args.bank:
+        if args.compress and args.patterns:
+            parser.error("--patterns cannot be combined with --compress")
+        options = {'voices': args.voices, 'compress': args.compress, 'patterns': args.patterns, 'fit': args.fit,
+                   'coalesce': args.coalesce}
+        try:
+            build_song_bank(args.bank, args.output or "SongBank.h", options, args.cache_dir, args.jobs, args.bin)
+        except (OSError, SongFormatError) as e:
+            print(f"Error: {e}", file=sys.stderr)
+            sys.exit(1)
+        sys.exit(0)
+    if args.midi_file is None:
+        parser.error("midi_file is required")
+    if args.compress and args.patterns:
+        # Repeat records jump backwards, the LZ stream can only be read forwards
+        parser.error("--patterns cannot be combined with --compress")
+
+    if args.raw_output:
+        # The host renderer's input: the same stream the header would hold, without the C around it
+        if args.compress or args.patterns or args.midi_file.lower().endswith('.bin'):
+            parser.error("--raw-output needs a .mid input and no --compress or --patterns")
+        try:
+            events = read_midi_events(args.midi_file)
+            bpm = args.bpm if args.bpm is not None else 60000000 / initial_tempo_us(events)
+            data, event_count, notes = build_song_data(events, args.voices, False, False, args.fit, args.coalesce)
+            with open(args.raw_output, 'wb') as f:
+                f.write(data)
+        except (OSError, SongFormatError) as e:
+            print(f"Error: {args.midi_file}: {e}", file=sys.stderr)
+            sys.exit(1)
+        print(f"{event_count} events at {bpm:.2f} BPM written to {args.raw_output}")
+        sys.exit(0)
+
+    if args.header is None:
+        parse_midi_to_arduino_array(args.midi_file, args.voices, args.compress, args.patterns, args.fit, args.coalesce)
+        sys.exit(0)
+
+    # Build step: turn a .mid or .bin song into a header that is validated at compile time
+    try:
+        if args.midi_file.lower().endswith('.bin'):
+            if args.voices is not None or args.fit is not None or args.coalesce is not None:
+                parser.error("--voices, --fit and --coalesce need a .mid input")
+            data, event_count, notes = pack_song_data(read_binary_song(args.midi_file), args.compress, args.patterns)
+            bpm = args.bpm if args.bpm is not None else 60000000 / DEFAULT_TEMPO_US
+        else:
+            events = read_midi_events(args.midi_file)
+            bpm = args.bpm if args.bpm is not None else 60000000 / initial_tempo_us(events)
+            data, event_count, notes = build_song_data(events, args.voices, args.compress, args.patterns, args.fit,
+                                                       args.coalesce)
+    except (OSError, SongFormatError) as e:
+        print(f"Error: {args.midi_file}: {e}", file=sys.stderr)
         sys.exit(1)
-        
-    midi_file = sys.argv[1]
-    parse_midi_to_arduino_array(midi_file)
\ No newline at end of file
+
+
+    header = generate_song_header(args.header.upper(), args.midi_file, data, event_count, bpm, args.compress, notes)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(header)
+    else:
+        print(header, end="")
@@ -0,0 +1,200 @@
+"""
+The song event format shared with the ESP32 player (SongFormat.h, MidiPlayer.h,
+LzStreamDecoder.h), and reading .mid files and raw event streams into it.
+"""
+import mido
+import heapq
+
+# Must match SYNTH_MAX_VOICES in Synthesizer.h
+DEFAULT_MAX_VOICES = 8
+
+# event_type byte layout: low nibble = type, high nibble = voice index + 1 (0 = unassigned)
+VOICE_SHIFT = 4
+MAX_ENCODABLE_VOICES = 15
+
+# Event types (low nibble of event_type)
+EVENT_TYPE_NOTE_OFF = 0
+EVENT_TYPE_NOTE_ON = 1
+EVENT_TYPE_LONG_DELTA = 2  # no-op carrying a 32-bit delta; upper 16 bits in the note/velocity bytes
+EVENT_TYPE_REPEAT = 3      # zero-time: play events [i - distance, i - distance + length) count times
+EVENT_TYPE_TEMPO = 4       # microseconds per quarter note in note/velocity/channel (24-bit, as in MIDI)
+EVENT_TYPE_CONTROL = 5     # MIDI control change: controller in note, value in velocity
+
+# Controllers the player acts on, must match SongFormat.h
+MIDI_CC_PAN = 10
+MIDI_CHANNELS = 16
+SYNTH_PAN_CENTER = 64  # CC10 value every channel starts at, as in Synthesizer.h
+
+# Player timing, must match MidiPlayer.h
+TICKS_PER_QUARTER_NOTE = 96
+DEFAULT_TEMPO_US = 500000  # MIDI default: 120 BPM
+
+# Order of events that land on the same tick: tempo first, then controllers (so a pan applies
+# to the notes starting with it), then note-offs, then note-ons, so a note that ends and
+# restarts on one tick is not killed right after starting
+EVENT_TICK_ORDER = {EVENT_TYPE_TEMPO: 0, EVENT_TYPE_CONTROL: 1, EVENT_TYPE_NOTE_OFF: 2, EVENT_TYPE_NOTE_ON: 3}
+
+# Player limits (MidiPlayer uses uint32_t for event indexing and deltas)
+MAX_SHORT_DELTA = 0xFFFF
+MAX_LONG_DELTA = 0xFFFFFFFF
+MAX_EVENT_COUNT = 0xFFFFFFFF
+
+# SongInfo.format values, must match SongFormat.h
+SONG_FORMAT_RAW = 0
+SONG_FORMAT_LZ = 1
+
+# LZ stream format, must match LzStreamDecoder.h
+LZ_WINDOW_SIZE = 256
+LZ_MIN_MATCH = 3
+LZ_MAX_MATCH = 0x7F + LZ_MIN_MATCH
+LZ_MAX_LITERAL_RUN = 0x80
+
+BYTES_PER_EVENT = 6
+
+# Repeat instructions, must match MidiPlayer.h and SongFormat.h
+MAX_REPEAT_DEPTH = 4
+MAX_REPEAT_COUNT = 0xFF
+MAX_REPEAT_FIELD = 0xFFFF    # length and distance are 16-bit
+MIN_REPEAT_EVENTS = 2        # a repeat record must replace more events than it costs
+
+class SongFormatError(Exception):
+    """Raised when a song cannot be represented in the player's event format."""
+
+def tempo_event(tick, tempo_us):
+    """Build an EVENT_TYPE_TEMPO event (24-bit microseconds per quarter note)."""
+    return {
+        'time': tick,
+        'type': EVENT_TYPE_TEMPO,
+        'note': (tempo_us >> 16) & 0xFF,
+        'velocity': (tempo_us >> 8) & 0xFF,
+        'channel': tempo_us & 0xFF
+    }
+
+def event_order(event):
+    """Merge key: tick, then tempo / control / note-off / note-on."""
+    return (event['time'], EVENT_TICK_ORDER[event['type']])
+
+def read_midi_events(midi_file_path):
+    """
+    Read note, tempo and pan (CC10) events from every track of a MIDI file.
+
+    Times are rescaled from the file's ticks_per_beat to the player's
+    TICKS_PER_QUARTER_NOTE. Each track is ordered with event_order and the
+    tracks are then merged with a stable k-way merge, so equal-tick events
+    keep their track order within each class. Zero-length notes (on and off
+    for the same note on the same tick) are dropped, since reordering them
+    would leave the note hanging.
+    Returns events with absolute times, sorted by time.
+    """
+    mid = mido.MidiFile(midi_file_path)
+    scale = TICKS_PER_QUARTER_NOTE / mid.ticks_per_beat
+    
+    # Structure to hold our parsed events, one list per track
+    tracks = []
+    
+    # Process all tracks
+    for track in mid.tracks:
+        events = []
+        started_this_tick = {}  # (channel, note) -> note-on event at the current tick
+        track_time = 0
+        for msg in track:
+            # Update track time (in file ticks, rescaled per event so rounding never accumulates)
+            track_time += msg.time
+            tick = round(track_time * scale)
+            
+            if msg.type == 'set_tempo':
+                events.append(tempo_event(tick, msg.tempo))
+            elif msg.type == 'control_change' and msg.control == MIDI_CC_PAN:
+                # Other controllers are ignored by the player, so they are not stored
+                events.append({
+                    'time': tick,
+                    'type': EVENT_TYPE_CONTROL,
+                    'note': msg.control,
+                    'velocity': msg.value,
+                    'channel': msg.channel
+                })
+            # Only process note_on and note_off events
+            elif msg.type == 'note_on' or msg.type == 'note_off':
+                # event_type: 0 = note off, 1 = note on
+                event_type = 1 if msg.type == 'note_on' and msg.velocity > 0 else 0
+                key = (msg.channel, msg.note)
+                
+                if event_type == 0:
+                    started = started_this_tick.pop(key, None)
+                    if started is not None and started['time'] == tick:
+                        events.remove(started)  # Zero-length note
+                        continue
+                
+                # Store event with absolute time
+                event = {
+                    'time': tick,
+                    'type': event_type,
+                    'note': msg.note,
+                    'velocity': msg.velocity,
+                    'channel': msg.channel
+                }
+                events.append(event)
+                if event_type == 1:
+                    started_this_tick[key] = event
+        
+        # Stable sort inside the track puts note-offs ahead of note-ons on the same tick
+        events.sort(key=event_order)
+        tracks.append(events)
+    
+    # Stable merge of the tracks by time
+    return list(heapq.merge(*tracks, key=event_order))
+
+def song_duration_ms(events):
+    """Playing time of absolute-time events, following tempo changes."""
+    tempo_us = DEFAULT_TEMPO_US
+    elapsed_us = 0.0
+    last_tick = 0
+    for event in events:
+        elapsed_us += (event['time'] - last_tick) * tempo_us / TICKS_PER_QUARTER_NOTE
+        last_tick = event['time']
+        if event['type'] == EVENT_TYPE_TEMPO:
+            tempo_us = (event['note'] << 16) | (event['velocity'] << 8) | event['channel']
+    return round(elapsed_us / 1000)
+
+def initial_tempo_us(events):
+    """Tempo in effect at tick 0 (MIDI default if the file sets none)."""
+    for event in events:
+        if event['time'] > 0:
+            break
+        if event['type'] == EVENT_TYPE_TEMPO:
+            return (event['note'] << 16) | (event['velocity'] << 8) | event['channel']
+    return DEFAULT_TEMPO_US
+
+def read_binary_song(bin_file_path):
+    """Read an already-encoded raw event stream (6 bytes per event) and validate it."""
+    with open(bin_file_path, 'rb') as f:
+        data = f.read()
+    validate_song_data(data)
+    return data
+
+def validate_song_data(data):
+    """
+    Check a raw event stream the same way SONG_VALIDATE does at compile time
+    (see SongFormat.h). Raises SongFormatError on the first problem.
+    """
+    if len(data) == 0 or len(data) % BYTES_PER_EVENT != 0:
+        raise SongFormatError(f"byte length {len(data)} is not a non-zero multiple of {BYTES_PER_EVENT}")
+    for index in range(len(data) // BYTES_PER_EVENT):
+        e = data[index * BYTES_PER_EVENT:(index + 1) * BYTES_PER_EVENT]
+        event_type = e[2] & 0x0F
+        if event_type in (0, 1):
+            if e[3] > 127 or e[4] > 127:
+                raise SongFormatError(f"event {index}: note {e[3]} / velocity {e[4]} out of range")
+        elif event_type == EVENT_TYPE_TEMPO:
+            if (e[3] << 16) | (e[4] << 8) | e[5] == 0:
+                raise SongFormatError(f"event {index}: zero tempo")
+        elif event_type == EVENT_TYPE_CONTROL:
+            if e[3] > 127 or e[4] > 127 or e[5] >= MIDI_CHANNELS:
+                raise SongFormatError(f"event {index}: controller {e[3]} / value {e[4]} / channel {e[5]} out of range")
+        elif event_type == EVENT_TYPE_REPEAT:
+            length = (e[0] << 8) | e[1]
+            distance = (e[3] << 8) | e[4]
+            if length == 0 or e[5] == 0 or distance < length or distance > index:
+                raise SongFormatError(f"event {index}: invalid repeat (length {length}, distance {distance}, count {e[5]})")
+        elif event_type != EVENT_TYPE_LONG_DELTA:
+            raise SongFormatError(f"event {index}: unknown event type {event_type}")
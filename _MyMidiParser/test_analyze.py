@@ -0,0 +1,115 @@
+import os
+import unittest
+
+from songformat import EVENT_TYPE_CONTROL, EVENT_TYPE_NOTE_OFF, EVENT_TYPE_NOTE_ON, MIDI_CC_PAN, read_midi_events
+from analyze import analyze_polyphony, assign_voices, coalesce_events, fit_polyphony
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+def bundled_events(name):
+    return read_midi_events(os.path.join(HERE, name))
+
+def note(time, note_number, on=True, velocity=100):
+    return {'time': time, 'type': EVENT_TYPE_NOTE_ON if on else EVENT_TYPE_NOTE_OFF, 'note': note_number,
+            'velocity': velocity if on else 0, 'channel': 0}
+
+def chord(notes, length=96):
+    """All notes starting at 0 (in order) and ending together."""
+    return [note(0, n) for n in notes] + [note(length, n, on=False) for n in notes]
+
+def steals(kept, max_voices):
+    """(tick, stolen note, new note) for every note-on assign_voices put on a busy voice."""
+    playing = [None] * max_voices
+    found = []
+    for e in kept:
+        if e['type'] == EVENT_TYPE_NOTE_ON:
+            if playing[e['voice']] not in (None, e['note']):
+                found.append((e['time'], playing[e['voice']], e['note']))
+            playing[e['voice']] = e['note']
+        elif e['type'] == EVENT_TYPE_NOTE_OFF:
+            playing[e['voice']] = None
+    return found
+
+def note_keys(events):
+    return {(e['time'], e['type'], e['note']) for e in events}
+
+class AssignVoicesTest(unittest.TestCase):
+    def test_oldest_note_is_stolen(self):
+        kept, stolen, dropped = assign_voices(chord([60, 64, 67]), 2)
+        self.assertEqual((stolen, dropped), (1, 1))
+        self.assertEqual([(e['note'], e['voice']) for e in kept if e['type'] == EVENT_TYPE_NOTE_ON],
+                         [(60, 0), (64, 1), (67, 0)])
+        self.assertNotIn(60, [e['note'] for e in kept if e['type'] == EVENT_TYPE_NOTE_OFF])
+
+    def test_fits_without_stealing(self):
+        kept, stolen, dropped = assign_voices(chord([60, 64, 67]), 3)
+        self.assertEqual((stolen, dropped, len(kept)), (0, 0, 6))
+
+class BundledStealingTest(unittest.TestCase):
+    # Pinned from the bundled songs: a change here changes what the synth plays
+    def test_tetris_finale_at_8_voices(self):
+        events = bundled_events("TetrisPianoFinale1.mid")
+        self.assertEqual(analyze_polyphony(events, 8)[0], 9)
+        kept, stolen, dropped = assign_voices(events, 8)
+        self.assertEqual((stolen, dropped), (3, 3))
+        self.assertEqual(steals(kept, 8), [(146, 88, 96), (720, 88, 96), (2256, 88, 96)])
+        self.assertEqual(note_keys(events) - note_keys(kept),
+                         {(192, EVENT_TYPE_NOTE_OFF, 88), (768, EVENT_TYPE_NOTE_OFF, 88),
+                          (2304, EVENT_TYPE_NOTE_OFF, 88)})
+
+    def test_la_bamba_at_6_voices(self):
+        events = bundled_events("La Bamba4.mid")
+        kept, stolen, dropped = assign_voices(events, 6)
+        self.assertEqual((stolen, dropped), (3, 3))
+        self.assertEqual(steals(kept, 6), [(5088, 72, 60), (5184, 76, 60), (5856, 72, 60)])
+        self.assertEqual(note_keys(events) - note_keys(kept),
+                         {(5171, EVENT_TYPE_NOTE_OFF, 72), (5187, EVENT_TYPE_NOTE_OFF, 76),
+                          (5938, EVENT_TYPE_NOTE_OFF, 72)})
+
+    def test_songs_within_budget_keep_every_event(self):
+        for name in ("StrobeCombined.mid", "TetrisA.mid"):
+            events = bundled_events(name)
+            kept, stolen, dropped = assign_voices(events, 6)
+            self.assertEqual((stolen, dropped, len(kept)), (0, 0, len(events)), name)
+
+class BundledFitTest(unittest.TestCase):
+    def assertFit(self, name, max_voices, removed):
+        events = bundled_events(name)
+        for strategy in ("velocity", "octave"):
+            fitted, changed = fit_polyphony([dict(e) for e in events], max_voices, strategy)
+            self.assertEqual(changed, 3, strategy)
+            self.assertEqual(note_keys(events) - note_keys(fitted), removed, strategy)
+            self.assertEqual(note_keys(fitted) - note_keys(events), set(), strategy)  # Nothing moved or added
+            self.assertEqual(analyze_polyphony(fitted, max_voices), (max_voices, []), strategy)
+
+    # Both strategies drop the incoming note rather than cut one that is sounding
+    def test_tetris_finale_at_8_voices(self):
+        self.assertFit("TetrisPianoFinale1.mid", 8,
+                       {(146, EVENT_TYPE_NOTE_ON, 96), (288, EVENT_TYPE_NOTE_OFF, 96),
+                        (720, EVENT_TYPE_NOTE_ON, 96), (768, EVENT_TYPE_NOTE_OFF, 96),
+                        (2256, EVENT_TYPE_NOTE_ON, 96), (2304, EVENT_TYPE_NOTE_OFF, 96)})
+
+    def test_la_bamba_at_6_voices(self):
+        self.assertFit("La Bamba4.mid", 6,
+                       {(5088, EVENT_TYPE_NOTE_ON, 60), (5180, EVENT_TYPE_NOTE_OFF, 60),
+                        (5184, EVENT_TYPE_NOTE_ON, 60), (5228, EVENT_TYPE_NOTE_OFF, 60),
+                        (5856, EVENT_TYPE_NOTE_ON, 60), (5948, EVENT_TYPE_NOTE_OFF, 60)})
+
+class AnalyzePolyphonyTest(unittest.TestCase):
+    def test_peak_and_drops(self):
+        self.assertEqual(analyze_polyphony(chord([60, 64, 67]), 8), (3, []))
+        self.assertEqual(analyze_polyphony(chord([60, 64, 67]), 2), (3, [(0, 67)]))
+
+class CoalesceTest(unittest.TestCase):
+    def test_redundant_pan_is_dropped(self):
+        pan = {'time': 0, 'type': EVENT_TYPE_CONTROL, 'note': MIDI_CC_PAN, 'velocity': 64, 'channel': 0}
+        events, (before, after, _, _) = coalesce_events([pan] + chord([60]))
+        self.assertEqual((before, after), (3, 2))
+        self.assertNotIn(EVENT_TYPE_CONTROL, [e['type'] for e in events])
+
+    def test_quantized_note_keeps_one_grid_step(self):
+        events, _ = coalesce_events([note(0, 60), note(2, 60, on=False)], grid=12)
+        self.assertEqual([e['time'] for e in events], [0, 12])
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,89 @@
+import contextlib
+import io
+import os
+import shutil
+import subprocess
+import tempfile
+import unittest
+
+from bank import BANK_CACHE_DIR, bank_song_name, build_song_bank
+from bankBuildTimes import make_song_library, song_path, transpose_first_note
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+OPTIONS = {'voices': 8, 'compress': False, 'patterns': False, 'fit': None, 'coalesce': None}
+
+def build_bank(midi_dir, output_path, binary=False, jobs=1):
+    """Run build_song_bank and return its report line."""
+    report = io.StringIO()
+    with contextlib.redirect_stdout(report):
+        build_song_bank(midi_dir, output_path, OPTIONS, jobs=jobs, binary=binary)
+    return report.getvalue()
+
+class BankSongNameTest(unittest.TestCase):
+    def test_names_are_unique_identifiers(self):
+        used = set()
+        names = [bank_song_name(path, used) for path in ("a/La Bamba4.mid", "b/la-bamba4.mid", "c/---.mid")]
+        self.assertEqual(names, ["SONG_LA_BAMBA4", "SONG_LA_BAMBA4_2", "SONG_UNTITLED"])
+
+class BuildSongBankTest(unittest.TestCase):
+    def setUp(self):
+        self.dir = tempfile.mkdtemp()
+        self.midi_dir = os.path.join(self.dir, "midi")
+        os.makedirs(self.midi_dir)
+        for name in ("cScale.mid", "TetrisA.mid"):
+            shutil.copy(os.path.join(HERE, name), self.midi_dir)
+
+    def tearDown(self):
+        shutil.rmtree(self.dir)
+
+    def build(self, output, binary=False):
+        return build_bank(self.midi_dir, os.path.join(self.dir, output), binary)
+
+    def test_second_run_comes_from_the_cache(self):
+        self.assertIn("2 converted, 0 from cache", self.build("SongBank.h"))
+        self.assertIn("0 converted, 2 from cache, 0 files changed", self.build("SongBank.h"))
+        with open(os.path.join(self.dir, "SongBank.h")) as f:
+            header = f.read()
+        self.assertIn('"cScale"', header)
+        self.assertIn("SONG_TETRISA_DATA", header)
+
+    def test_incbin_paths_are_relative(self):
+        self.build(os.path.join("sketch", "SongBank.h"), binary=True)
+        with open(os.path.join(self.dir, "sketch", "SongBank.S")) as f:
+            asm = f.read()
+        incbins = [line.strip() for line in asm.splitlines() if ".incbin" in line]
+        self.assertEqual(incbins, ['.incbin "songs/SONG_TETRISA.bin"', '.incbin "songs/SONG_CSCALE.bin"'])
+        # Moving the sketch must not break the bank
+        moved = os.path.join(self.dir, "moved")
+        shutil.move(os.path.join(self.dir, "sketch"), moved)
+        if shutil.which("gcc"):
+            subprocess.run(["gcc", "-c", os.path.join(moved, "SongBank.S"), "-I", moved, "-o",
+                            os.path.join(self.dir, "SongBank.o")], cwd=self.dir, check=True)
+
+class LargeBankTest(unittest.TestCase):
+    # Full against incremental rebuild of a 100-song library; bankBuildTimes.py
+    # times the same builds, compile included
+    SONG_COUNT = 100
+
+    def setUp(self):
+        self.dir = tempfile.mkdtemp()
+        self.midi_dir = os.path.join(self.dir, "midi")
+        make_song_library(self.midi_dir, self.SONG_COUNT)
+
+    def tearDown(self):
+        shutil.rmtree(self.dir)
+
+    def build(self, binary):
+        return build_bank(self.midi_dir, os.path.join(self.dir, "SongBank.h"), binary, jobs=None)
+
+    def test_incremental_build_converts_only_the_edited_song(self):
+        for binary in (False, True):
+            with self.subTest(binary=binary):
+                shutil.rmtree(os.path.join(self.dir, BANK_CACHE_DIR), ignore_errors=True)
+                self.assertIn(f"({self.SONG_COUNT} converted, 0 from cache", self.build(binary))
+                transpose_first_note(song_path(self.midi_dir, 42))
+                # Only SongBank.h, or only that song's .bin: the sizes and the .S stay the same
+                self.assertIn(f"(1 converted, {self.SONG_COUNT - 1} from cache, 1 files changed)", self.build(binary))
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,177 @@
+import os
+import random
+import shutil
+import tempfile
+import unittest
+
+import mido
+
+from songformat import (
+    BYTES_PER_EVENT, EVENT_TYPE_LONG_DELTA, EVENT_TYPE_NOTE_OFF, EVENT_TYPE_NOTE_ON, MAX_SHORT_DELTA,
+    TICKS_PER_QUARTER_NOTE, SongFormatError, read_midi_events, song_duration_ms, validate_song_data,
+)
+from encode import build_song_data, expand_patterns, find_patterns, lz_compress, lz_decompress, split_long_deltas
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+BUNDLED_SONGS = ("cScale.mid", "La Bamba4.mid", "StrobeCombined.mid", "TetrisA.mid")
+
+def song_data(name, **options):
+    return build_song_data(read_midi_events(os.path.join(HERE, name)), **options)
+
+def note_events(times, length=48):
+    """One note per start tick, cycling through an octave; a note ends before the next starts."""
+    events = []
+    for i, time in enumerate(times):
+        note = 60 + i % 12
+        events.append({'time': time, 'type': EVENT_TYPE_NOTE_ON, 'note': note, 'velocity': 100, 'channel': 0})
+        events.append({'time': time + length, 'type': EVENT_TYPE_NOTE_OFF, 'note': note, 'velocity': 0, 'channel': 0})
+    return events
+
+def decode_events(data):
+    """Absolute-time (time, type, note) tuples of a raw stream, summing deltas like MidiPlayer."""
+    time = 0
+    decoded = []
+    for i in range(0, len(data), BYTES_PER_EVENT):
+        e = data[i:i + BYTES_PER_EVENT]
+        delta = (e[0] << 8) | e[1]
+        if e[2] & 0x0F == EVENT_TYPE_LONG_DELTA:
+            delta |= ((e[3] << 8) | e[4]) << 16
+        time += delta
+        if e[2] & 0x0F != EVENT_TYPE_LONG_DELTA:
+            decoded.append((time, e[2] & 0x0F, e[3]))
+    return decoded
+
+class LzTest(unittest.TestCase):
+    def test_round_trips(self):
+        rng = random.Random(1)
+        samples = [b"", b"a", bytes(1000), bytes(rng.randrange(4) for _ in range(5000))]
+        samples += [song_data(name)[0] for name in BUNDLED_SONGS]
+        for data in samples:
+            self.assertEqual(lz_decompress(lz_compress(data), len(data)), data)
+
+class PatternTest(unittest.TestCase):
+    def test_repeat_records_expand_to_the_original(self):
+        for name in BUNDLED_SONGS:
+            data = song_data(name)[0]
+            patterned = find_patterns(data)
+            validate_song_data(patterned)
+            self.assertLessEqual(len(patterned), len(data), name)
+            self.assertEqual(b"".join(expand_patterns(patterned)), data, name)
+
+class LongDeltaTest(unittest.TestCase):
+    def split(self, delta):
+        return split_long_deltas([{'time': delta, 'delta': delta, 'type': EVENT_TYPE_NOTE_ON, 'note': 60,
+                                   'velocity': 100, 'channel': 0}])
+
+    def test_split_starts_above_16_bits(self):
+        self.assertEqual([e['delta'] for e in self.split(MAX_SHORT_DELTA)], [MAX_SHORT_DELTA])
+        carrier, event = self.split(MAX_SHORT_DELTA + 1)
+        self.assertEqual(carrier['type'], EVENT_TYPE_LONG_DELTA)
+        self.assertEqual((carrier['delta'] & 0xFFFF, carrier['note'], carrier['velocity']), (0, 0, 1))
+        self.assertEqual((event['type'], event['delta']), (EVENT_TYPE_NOTE_ON, 0))
+
+    def test_split_keeps_all_32_bits(self):
+        carrier, event = self.split(0xFFFFFFFF)
+        self.assertEqual((carrier['delta'] & 0xFFFF, carrier['note'], carrier['velocity']), (0xFFFF, 0xFF, 0xFF))
+        with self.assertRaises(SongFormatError):
+            self.split(0x100000000)
+
+    def test_encoded_deltas_add_up_around_the_boundary(self):
+        times = [0, MAX_SHORT_DELTA, 2 * MAX_SHORT_DELTA + 1, 3 * MAX_SHORT_DELTA + 3, 0x30000000]
+        events = note_events(times, length=MAX_SHORT_DELTA)
+        data, event_count, _ = build_song_data([dict(e) for e in events])
+        validate_song_data(data)
+        self.assertEqual(decode_events(data), [(e['time'], e['type'], e['note']) for e in events])
+
+class LargeSongTest(unittest.TestCase):
+    def test_event_count_above_16_bits(self):
+        events = note_events(range(0, 96 * 40000, 96))  # 80000 events
+        data, event_count, _ = build_song_data([dict(e) for e in events], max_voices=8)
+        self.assertGreater(event_count, 0xFFFF)
+        self.assertEqual(event_count, len(events))
+        self.assertEqual(len(data), event_count * BYTES_PER_EVENT)
+        validate_song_data(data)
+        packed, packed_count, _ = build_song_data([dict(e) for e in events], max_voices=8, compress=True)
+        self.assertEqual(packed_count, event_count)
+        self.assertEqual(lz_decompress(packed, packed_count * BYTES_PER_EVENT), data)
+
+    def test_multi_hour_song_round_trips(self):
+        # Three hours at 120 BPM: a phrase every bar, with a 20-minute silence every hour
+        hour = 3600 * 2 * TICKS_PER_QUARTER_NOTE
+        silence = 1200 * 2 * TICKS_PER_QUARTER_NOTE
+        times = [t for t in range(0, 3 * hour, 4 * TICKS_PER_QUARTER_NOTE) if t % hour < hour - silence]
+        events = note_events(times)
+        self.assertGreater(silence, MAX_SHORT_DELTA)
+        self.assertGreater(song_duration_ms(events), 2.5 * 3600 * 1000)
+        for options in ({}, {'max_voices': 8}, {'max_voices': 8, 'patterns': True}, {'compress': True}):
+            data, event_count, _ = build_song_data([dict(e) for e in events], **options)
+            if options.get('compress'):
+                data = lz_decompress(data, event_count * BYTES_PER_EVENT)
+            elif options.get('patterns'):
+                data = b"".join(expand_patterns(data))
+            self.assertEqual(decode_events(data), [(e['time'], e['type'], e['note']) for e in events], options)
+
+class BuildSongDataTest(unittest.TestCase):
+    def test_every_option_produces_a_valid_stream(self):
+        for options in ({}, {'max_voices': 8}, {'max_voices': 4, 'fit': 'octave'}, {'coalesce': 4},
+                        {'max_voices': 8, 'patterns': True}):
+            data, event_count, notes = song_data("TetrisA.mid", **options)
+            validate_song_data(data)
+            self.assertEqual(event_count, len(data) // BYTES_PER_EVENT, options)
+
+    def test_compressed_stream_holds_the_raw_events(self):
+        raw, raw_count, _ = song_data("La Bamba4.mid", max_voices=8)
+        packed, packed_count, _ = song_data("La Bamba4.mid", max_voices=8, compress=True)
+        self.assertEqual(packed_count, raw_count)
+        self.assertEqual(lz_decompress(packed, raw_count * BYTES_PER_EVENT), raw)
+
+    def test_fit_output(self):
+        data, event_count, notes = song_data("TetrisPianoFinale1.mid", max_voices=8, fit='velocity')
+        self.assertEqual(notes[:3], ["Fitted to 8 voices (velocity): 3 notes dropped or shortened",
+                                     "event_type high nibble: voice index + 1, pre-allocated for 8 voices",
+                                     "(0 notes stolen, 0 stale note-offs removed)"])
+        self.assertEqual(event_count, 482)
+        self.assertNotIn((146, EVENT_TYPE_NOTE_ON, 96), decode_events(data))
+        # Without --fit the same budget is met by stealing instead
+        _, _, notes = song_data("TetrisPianoFinale1.mid", max_voices=8)
+        self.assertIn("(3 notes stolen, 3 stale note-offs removed)", notes)
+
+class ZeroLengthNoteTest(unittest.TestCase):
+    # Zero-length notes are dropped when the file is read; no later step may bring them back
+    def setUp(self):
+        self.work_dir = tempfile.mkdtemp()
+
+    def tearDown(self):
+        shutil.rmtree(self.work_dir)
+
+    def with_zero_length_notes(self, name, ticks):
+        """Copy of a bundled song with an extra track of zero-length note 127s, ticks in file ticks."""
+        mid = mido.MidiFile(os.path.join(HERE, name))
+        track = mido.MidiTrack()
+        last = 0
+        for tick in ticks:
+            track.append(mido.Message('note_on', note=127, velocity=90, time=tick - last))
+            track.append(mido.Message('note_off', note=127, velocity=0, time=0))
+            last = tick
+        mid.type = 1
+        mid.tracks.append(track)
+        path = os.path.join(self.work_dir, name)
+        mid.save(path)
+        return path
+
+    def test_injected_notes_stay_dropped(self):
+        # Ticks where the songs already overflow 8 or 6 voices, where a phantom note would steal
+        ticks = [0, 146, 192, 720, 2256, 5088, 5184]
+        for name in ("TetrisPianoFinale1.mid", "La Bamba4.mid"):
+            original = read_midi_events(os.path.join(HERE, name))
+            injected = read_midi_events(self.with_zero_length_notes(name, ticks))
+            self.assertEqual(injected, original, name)
+            for options in ({'coalesce': 1}, {'coalesce': 12}, {'max_voices': 6}, {'max_voices': 6, 'fit': 'velocity'},
+                            {'max_voices': 8, 'fit': 'octave', 'coalesce': 1}):
+                expected = build_song_data([dict(e) for e in original], **options)
+                data, event_count, notes = build_song_data([dict(e) for e in injected], **options)
+                self.assertEqual((data, event_count, notes), expected, (name, options))
+                self.assertNotIn(127, [note for _, _, note in decode_events(data)], (name, options))
+
+if __name__ == "__main__":
+    unittest.main()
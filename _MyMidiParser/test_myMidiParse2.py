@@ -0,0 +1,85 @@
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import unittest
+
+import mido
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+def run_cli(*args):
+    return subprocess.run([sys.executable, os.path.join(HERE, "myMidiParse2.py")] + list(args), cwd=HERE,
+                          capture_output=True, text=True)
+
+class VoicesOptionTest(unittest.TestCase):
+    def assert_rejected(self, result):
+        self.assertEqual(result.returncode, 2, result.stderr)
+        self.assertIn("--voices must be between 1 and 15", result.stderr)
+        self.assertNotIn("Traceback", result.stderr)
+        self.assertEqual(result.stdout, "")
+
+    def test_out_of_range_voices_are_rejected_in_every_mode(self):
+        self.assert_rejected(run_cli("cScale.mid", "--voices", "16"))
+        self.assert_rejected(run_cli("cScale.mid", "--voices", "0", "--header", "SCALE"))
+        self.assert_rejected(run_cli("--analyze", "cScale.mid", "--voices", "0"))
+        self.assert_rejected(run_cli("--analyze", "cScale.mid", "--voices", "16"))
+
+    def test_largest_encodable_voice_count_is_accepted(self):
+        result = run_cli("cScale.mid", "--voices", "15")
+        self.assertEqual(result.returncode, 0, result.stderr)
+        self.assertIn("pre-allocated for 15 voices", result.stdout)
+
+class BankVoicesTest(unittest.TestCase):
+    def setUp(self):
+        self.dir = tempfile.mkdtemp()
+        self.midi_dir = os.path.join(self.dir, "midi")
+        os.makedirs(self.midi_dir)
+        # A 16-note cluster: more notes than the largest voice budget
+        track = mido.MidiTrack()
+        track += [mido.Message('note_on', note=48 + n, velocity=100, time=0) for n in range(16)]
+        track += [mido.Message('note_off', note=48 + n, velocity=0, time=480 if n == 0 else 0) for n in range(16)]
+        mido.MidiFile(tracks=[track]).save(os.path.join(self.midi_dir, "cluster.mid"))
+
+    def tearDown(self):
+        shutil.rmtree(self.dir)
+
+    def test_bank_rejects_out_of_range_voices_before_writing(self):
+        output = os.path.join(self.dir, "out", "SongBank.h")
+        result = run_cli("--bank", self.midi_dir, "--voices", "16", "-o", output)
+        self.assertEqual(result.returncode, 2, result.stderr)
+        self.assertIn("--voices must be between 1 and 15", result.stderr)
+        self.assertNotIn("Traceback", result.stderr)
+        self.assertFalse(os.path.exists(os.path.dirname(output)))  # Not even the cache was created
+
+    def test_bank_encodes_the_last_voice(self):
+        output = os.path.join(self.dir, "out", "SongBank.h")
+        result = run_cli("--bank", self.midi_dir, "--voices", "15", "-o", output)
+        self.assertEqual(result.returncode, 0, result.stderr)
+        with open(output) as f:
+            header = f.read()
+        self.assertIn("(1 notes stolen, 1 stale note-offs removed)", header)
+        self.assertIn("0xf1, 0x3e", header)  # Note-on on voice index 14
+
+class RawOutputTest(unittest.TestCase):
+    def setUp(self):
+        self.dir = tempfile.mkdtemp()
+
+    def tearDown(self):
+        shutil.rmtree(self.dir)
+
+    def test_raw_output_matches_the_reported_event_count(self):
+        output = os.path.join(self.dir, "cScale.bin")
+        result = run_cli("cScale.mid", "--raw-output", output)
+        self.assertEqual(result.returncode, 0, result.stderr)
+        self.assertEqual(result.stdout, f"16 events at 120.00 BPM written to {output}\n")
+        self.assertEqual(os.path.getsize(output), 16 * 6)
+
+    def test_raw_output_rejects_compressed_streams(self):
+        result = run_cli("cScale.mid", "--raw-output", os.path.join(self.dir, "x.bin"), "--compress")
+        self.assertEqual(result.returncode, 2, result.stderr)
+        self.assertNotIn("Traceback", result.stderr)
+
+if __name__ == "__main__":
+    unittest.main()
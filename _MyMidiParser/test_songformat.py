@@ -0,0 +1,53 @@
+import os
+import unittest
+
+from songformat import (
+    EVENT_TYPE_NOTE_OFF, EVENT_TYPE_NOTE_ON, EVENT_TYPE_TEMPO, SongFormatError, event_order, read_midi_events,
+    song_duration_ms, tempo_event, validate_song_data,
+)
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+def midi_path(name):
+    return os.path.join(HERE, name)
+
+class ReadMidiEventsTest(unittest.TestCase):
+    def test_events_are_in_play_order(self):
+        for name in ("cScale.mid", "TetrisA.mid", "La Bamba4.mid"):
+            events = read_midi_events(midi_path(name))
+            self.assertTrue(events, name)
+            self.assertEqual(events, sorted(events, key=event_order), name)
+
+    def test_c_scale_plays_eight_quarter_notes(self):
+        events = read_midi_events(midi_path("cScale.mid"))
+        ons = [e for e in events if e['type'] == EVENT_TYPE_NOTE_ON]
+        offs = [e for e in events if e['type'] == EVENT_TYPE_NOTE_OFF]
+        self.assertEqual([e['note'] for e in ons], [60, 62, 64, 65, 67, 69, 71, 72])
+        self.assertEqual(len(offs), len(ons))
+
+    def test_duration_follows_tempo(self):
+        events = [
+            {'time': 0, 'type': EVENT_TYPE_NOTE_ON, 'note': 60, 'velocity': 100, 'channel': 0},
+            tempo_event(96, 1000000),
+            {'time': 192, 'type': EVENT_TYPE_NOTE_OFF, 'note': 60, 'velocity': 0, 'channel': 0},
+        ]
+        self.assertEqual(song_duration_ms(events), 500 + 1000)
+
+class ValidateSongDataTest(unittest.TestCase):
+    def test_accepts_a_valid_stream(self):
+        validate_song_data(bytes([0, 0, 0x11, 60, 100, 0, 0, 96, 0x10, 60, 0, 0]))
+
+    def test_rejects_bad_streams(self):
+        bad = {
+            "partial event": bytes([0, 0, 0x11, 60, 100]),
+            "empty": b"",
+            "velocity": bytes([0, 0, 0x11, 60, 200, 0]),
+            "zero tempo": bytes([0, 0, EVENT_TYPE_TEMPO, 0, 0, 0]),
+            "repeat before the start": bytes([0, 2, 3, 0, 2, 1]),
+        }
+        for reason, data in bad.items():
+            with self.assertRaises(SongFormatError, msg=reason):
+                validate_song_data(data)
+
+if __name__ == "__main__":
+    unittest.main()
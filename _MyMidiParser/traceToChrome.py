@@ -0,0 +1,89 @@
+import sys
+import json
+import argparse
+
+# Converts the trace dump printed by SynthTrace::dump() (SYNTH_TRACE=1) into
+# Chrome trace JSON for chrome://tracing or https://ui.perfetto.dev
+#
+# Dump format, between "TRACE_DUMP <count>" and "TRACE_DUMP_END":
+#   T,time_us,task,core,phase,name,arg
+# phase is B (span begin), E (span end) or i (instant).
+
+def read_trace_dumps(lines):
+    """Return the entries of every dump in a serial log, as lists of dicts."""
+    dumps = []
+    current = None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("TRACE_DUMP_END"):
+            if current is not None:
+                dumps.append(current)
+            current = None
+        elif line.startswith("TRACE_DUMP"):
+            current = []
+        elif current is not None and line.startswith("T,"):
+            fields = line.split(",")
+            if len(fields) != 7:
+                continue  # Line mangled by other serial output
+            current.append({
+                'time_us': int(fields[1]),
+                'task': fields[2],
+                'core': int(fields[3]),
+                'phase': fields[4],
+                'name': fields[5],
+                'arg': int(fields[6]),
+            })
+    return dumps
+
+def to_chrome_trace(entries):
+    """Build the Chrome trace object: one track per FreeRTOS task."""
+    events = []
+    tids = {}
+    if not entries:
+        return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+    # micros() is 32-bit: unwrap so the timeline stays monotonic
+    base = entries[0]['time_us']
+    offset = 0
+    last = base
+    for entry in entries:
+        if entry['time_us'] < last and last - entry['time_us'] > 0x80000000:
+            offset += 1 << 32
+        last = entry['time_us']
+        task = entry['task']
+        if task not in tids:
+            tids[task] = len(tids) + 1
+            events.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': tids[task],
+                           'args': {'name': f"task {task} (core {entry['core']})"}})
+        event = {
+            'name': entry['name'],
+            'ph': entry['phase'],
+            'ts': entry['time_us'] + offset - base,
+            'pid': 1,
+            'tid': tids[task],
+            'args': {'arg': entry['arg'], 'core': entry['core']},
+        }
+        if entry['phase'] == 'i':
+            event['s'] = 't'  # Instant scoped to its task track
+        events.append(event)
+    return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Convert a SynthTrace serial dump into Chrome trace JSON")
+    parser.add_argument("log", help="serial log containing a TRACE_DUMP (use - for stdin)")
+    parser.add_argument("-o", "--output", default="trace.json", help="output file (default trace.json)")
+    parser.add_argument("--dump", type=int, default=-1, help="which dump to convert if the log has several (default: last)")
+    args = parser.parse_args()
+
+    if args.log == "-":
+        lines = sys.stdin.readlines()
+    else:
+        with open(args.log, errors="replace") as f:
+            lines = f.readlines()
+    dumps = read_trace_dumps(lines)
+    if not dumps:
+        print("Error: no TRACE_DUMP found in the log", file=sys.stderr)
+        sys.exit(1)
+    trace = to_chrome_trace(dumps[args.dump])
+    with open(args.output, 'w') as f:
+        json.dump(trace, f)
+    print(f"{len(dumps[args.dump])} entries from dump {args.dump % len(dumps)} of {len(dumps)} written to {args.output}")
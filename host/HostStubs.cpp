@@ -0,0 +1,360 @@
+// Host implementations of the Arduino, FreeRTOS and I2S calls declared in stubs/
+#include <Arduino.h>
+#include "driver/i2s.h"
+#include "HostStubs.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// --- Blocking calls under a mutex ---
+
+static thread_local int mutexes_held = 0; // Semaphore mutexes the calling task holds
+static std::atomic<unsigned long> blocking_calls_under_mutex(0);
+static std::atomic<const char*> first_blocking_call_under_mutex(nullptr);
+
+// Called by every stand-in that can block: counts the call if its task holds a mutex
+static void checkBlockingCall(const char* call) {
+    if (mutexes_held == 0) return;
+    if (blocking_calls_under_mutex.fetch_add(1) == 0) first_blocking_call_under_mutex = call;
+}
+
+unsigned long hostBlockingCallsUnderMutex(const char** first_call) {
+    if (first_call != NULL) *first_call = first_blocking_call_under_mutex.load();
+    return blocking_calls_under_mutex.load();
+}
+
+static std::mutex serial_mutex; // Tasks print too: keep lines whole
+static bool serial_enabled = true;
+static FILE* serial_out = NULL;   // NULL: stdout
+static const char* serial_line_prefix = NULL; // Non-NULL: only lines starting with it are printed
+static std::string serial_line;   // The line being printed, while filtering
+
+void hostSerialEnable(bool enabled) {
+    std::lock_guard<std::mutex> lock(serial_mutex);
+    serial_enabled = enabled;
+}
+
+void hostSerialRedirect(FILE* file) {
+    std::lock_guard<std::mutex> lock(serial_mutex);
+    fflush(serial_out != NULL ? serial_out : stdout);
+    serial_out = file;
+}
+
+void hostSerialOnlyLines(const char* prefix) {
+    std::lock_guard<std::mutex> lock(serial_mutex);
+    serial_line_prefix = prefix;
+    serial_line.clear();
+}
+
+static FILE* serialFile() {
+    return serial_out != NULL ? serial_out : stdout;
+}
+
+// Print under serial_mutex, through the line filter if there is one
+static void serialWrite(const char* text) {
+    if (!serial_enabled) return;
+    if (serial_line_prefix == NULL) {
+        fputs(text, serialFile());
+        return;
+    }
+    for (; *text != '\0'; ++text) {
+        serial_line += *text;
+        if (*text != '\n') continue;
+        if (serial_line.compare(0, strlen(serial_line_prefix), serial_line_prefix) == 0) {
+            fputs(serial_line.c_str(), serialFile());
+        }
+        serial_line.clear();
+    }
+}
+
+size_t HardwareSerial::print(const char* text) {
+    checkBlockingCall("Serial.print"); // The UART FIFO fills: a print waits on it
+    std::lock_guard<std::mutex> lock(serial_mutex);
+    serialWrite(text);
+    return strlen(text);
+}
+
+size_t HardwareSerial::println(const char* text) {
+    checkBlockingCall("Serial.println");
+    std::lock_guard<std::mutex> lock(serial_mutex);
+    serialWrite(text);
+    serialWrite("\n");
+    return strlen(text) + 1;
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+    checkBlockingCall("Serial.printf");
+    std::lock_guard<std::mutex> lock(serial_mutex);
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    if (written > 0 && serial_enabled) {
+        std::string text((size_t)written + 1, '\0');
+        va_start(args, format);
+        vsnprintf(&text[0], text.size(), format, args);
+        va_end(args);
+        serialWrite(text.c_str());
+    }
+    return written < 0 ? 0 : (size_t)written;
+}
+
+void HardwareSerial::flush() {
+    checkBlockingCall("Serial.flush");
+    std::lock_guard<std::mutex> lock(serial_mutex);
+    fflush(serialFile());
+}
+
+// --- Time ---
+
+static const std::chrono::steady_clock::time_point boot_time = std::chrono::steady_clock::now();
+static std::atomic<bool> clock_simulated(false);
+static std::atomic<uint64_t> simulated_us(0);
+
+static uint64_t nanosSinceBoot() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - boot_time).count();
+}
+
+static uint64_t microsSinceBoot() {
+    return clock_simulated.load(std::memory_order_relaxed) ? simulated_us.load(std::memory_order_relaxed)
+                                                           : nanosSinceBoot() / 1000;
+}
+
+void hostSetClock(uint64_t micros_since_boot) {
+    simulated_us = micros_since_boot;
+    clock_simulated = true;
+}
+
+void hostAdvanceClock(uint64_t us) {
+    simulated_us += us;
+}
+
+uint32_t EspClass::getCycleCount() {
+    return (uint32_t)(nanosSinceBoot() * getCpuFreqMHz() / 1000); // Wraps like the real counter; never simulated
+}
+
+unsigned long millis() {
+    return (unsigned long)(uint32_t)(microsSinceBoot() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)(uint32_t)microsSinceBoot();
+}
+
+void delay(unsigned long ms) {
+    checkBlockingCall("delay");
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+// --- Memory and randomness ---
+
+bool psramFound() {
+    return false;
+}
+
+void* heap_caps_malloc(size_t size, uint32_t) {
+    return malloc(size);
+}
+
+void heap_caps_free(void* ptr) {
+    free(ptr);
+}
+
+static std::mt19937 random_engine;
+
+uint32_t esp_random() {
+    return std::random_device()();
+}
+
+void randomSeed(unsigned long seed) {
+    random_engine.seed((uint32_t)seed);
+}
+
+long random(long max) {
+    return max > 0 ? (long)(random_engine() % (unsigned long)max) : 0;
+}
+
+// --- FreeRTOS ---
+
+struct TaskStart {
+    TaskFunction_t function;
+    void* parameter;
+};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char*, uint32_t, void* parameter,
+                                   UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+    std::thread thread(function, parameter);
+    if (handle != NULL) *handle = (TaskHandle_t)(uintptr_t)std::hash<std::thread::id>()(thread.get_id());
+    thread.detach(); // Like a task, it runs until the process ends
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stack_depth, void* parameter,
+                       UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(function, name, stack_depth, parameter, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t) {
+    // Only ever called by a task on itself, as it returns: the thread ends with it
+}
+
+void vTaskDelay(TickType_t ticks) {
+    delay(ticks * portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return (TaskHandle_t)(uintptr_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+}
+
+BaseType_t xPortGetCoreID() {
+    return 1;
+}
+
+// Waits for ready() under lock, up to ticks (portMAX_DELAY: forever)
+template <class Ready>
+static bool waitFor(std::condition_variable& condition, std::unique_lock<std::mutex>& lock, TickType_t ticks,
+                    Ready ready) {
+    if (ticks == portMAX_DELAY) {
+        condition.wait(lock, ready);
+        return true;
+    }
+    return condition.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), ready);
+}
+
+struct HostQueue {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t> > items;
+    size_t length;
+    size_t item_size;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    HostQueue* queue = new HostQueue();
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait) {
+    if (ticks_to_wait != 0) checkBlockingCall("xQueueSend");
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!waitFor(queue->changed, lock, ticks_to_wait, [queue] { return queue->items.size() < queue->length; })) {
+        return pdFALSE;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(item);
+    queue->items.push_back(std::vector<uint8_t>(bytes, bytes + queue->item_size));
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticks_to_wait) {
+    if (ticks_to_wait != 0) checkBlockingCall("xQueueReceive");
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!waitFor(queue->changed, lock, ticks_to_wait, [queue] { return !queue->items.empty(); })) {
+        return pdFALSE;
+    }
+    memcpy(buffer, queue->items.front().data(), queue->item_size);
+    queue->items.pop_front();
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return (UBaseType_t)queue->items.size();
+}
+
+struct HostMutex {
+    std::mutex mutex;
+    std::condition_variable released;
+    bool taken;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    HostMutex* semaphore = new HostMutex();
+    semaphore->taken = false;
+    return semaphore;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    delete semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait) {
+    if (ticks_to_wait != 0) checkBlockingCall("xSemaphoreTake"); // Waiting for a second mutex
+    std::unique_lock<std::mutex> lock(semaphore->mutex);
+    if (!waitFor(semaphore->released, lock, ticks_to_wait, [semaphore] { return !semaphore->taken; })) {
+        return pdFALSE;
+    }
+    semaphore->taken = true;
+    ++mutexes_held;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    std::lock_guard<std::mutex> lock(semaphore->mutex);
+    if (!semaphore->taken) return pdFALSE;
+    semaphore->taken = false;
+    --mutexes_held; // A FreeRTOS mutex is given back by the task that took it
+    semaphore->released.notify_one();
+    return pdTRUE;
+}
+
+// --- I2S ---
+
+static uint32_t i2s_rate = 0;
+static uint32_t i2s_frame_bytes = 4;
+
+const char* esp_err_to_name(esp_err_t err) {
+    return err == ESP_OK ? "ESP_OK" : "ESP_FAIL";
+}
+
+esp_err_t i2s_driver_install(i2s_port_t, const i2s_config_t* config, int, void* queue) {
+    i2s_rate = config->sample_rate;
+    int channels = config->channel_format == I2S_CHANNEL_FMT_RIGHT_LEFT ? 2 : 1;
+    i2s_frame_bytes = (uint32_t)(config->bits_per_sample / 8 * channels);
+    if (queue != NULL) *static_cast<QueueHandle_t*>(queue) = NULL; // No events: the host never underruns
+    return ESP_OK;
+}
+
+esp_err_t i2s_driver_uninstall(i2s_port_t) {
+    return ESP_OK;
+}
+
+esp_err_t i2s_set_pin(i2s_port_t, const i2s_pin_config_t*) {
+    return ESP_OK;
+}
+
+// Takes as long as the data takes to play, as a write into full DMA buffers does.
+// Only a task started by Synthesizer::init() calls it; offline renders never do.
+esp_err_t i2s_write(i2s_port_t, const void*, size_t size, size_t* bytes_written, TickType_t ticks_to_wait) {
+    if (ticks_to_wait != 0) checkBlockingCall("i2s_write");
+    if (i2s_rate != 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds((uint64_t)size / i2s_frame_bytes * 1000000 / i2s_rate));
+    }
+    if (bytes_written != NULL) *bytes_written = size;
+    return ESP_OK;
+}
+
+float i2s_get_clk(i2s_port_t) {
+    return (float)i2s_rate;
+}
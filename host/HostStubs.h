@@ -0,0 +1,32 @@
+#ifndef HOST_STUBS_H
+#define HOST_STUBS_H
+
+#include <cstdint>
+#include <cstdio>
+
+// Controls for the host stand-ins that have no counterpart on the ESP32
+
+// Drop everything printed to Serial (the synth's own log), e.g. so a tool's
+// report is not buried in it. On by default.
+void hostSerialEnable(bool enabled);
+
+// Send Serial output to file instead of stdout (NULL: back to stdout), e.g. to
+// save a SYNTH_TRACE_DUMP() for traceToChrome.py. The caller closes the file.
+void hostSerialRedirect(FILE* file);
+
+// Print only the Serial lines that start with prefix, e.g. "BENCH " to keep the
+// synth's log out of a benchmark's results (NULL: every line, the default)
+void hostSerialOnlyLines(const char* prefix);
+
+// Simulated time: from the first hostSetClock() on, millis() and micros() return
+// it and only hostAdvanceClock() moves it, so MidiPlayer::update() can be driven
+// without waiting, also across the 32-bit wrap. ESP.getCycleCount() stays real.
+void hostSetClock(uint64_t micros_since_boot);
+void hostAdvanceClock(uint64_t us);
+
+// Calls that can block a task (Serial output, delay, waits on a queue, semaphore
+// or i2s_write with a timeout) made while that task held a semaphore mutex, i.e.
+// the synth's voicesMutex. Optionally returns the name of the first such call.
+unsigned long hostBlockingCallsUnderMutex(const char** first_call = nullptr);
+
+#endif // HOST_STUBS_H
@@ -0,0 +1,87 @@
+#include "WavFile.h"
+#include <cstring>
+#include <cerrno>
+#include <sys/stat.h>
+
+static void putLe(uint8_t* out, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) out[i] = (uint8_t)(value >> (8 * i));
+}
+
+bool WavFile::open(const char* path, uint32_t rate, int channel_count) {
+    close();
+    file = fopen(path, "wb");
+    data_bytes = 0;
+    channels = channel_count;
+    sample_rate = rate;
+    return file != NULL && writeHeader();
+}
+
+bool WavFile::write(const int16_t* samples, size_t count) {
+    if (file == NULL) return false;
+    uint8_t bytes[512];
+    while (count > 0) {
+        size_t run = count < sizeof(bytes) / 2 ? count : sizeof(bytes) / 2;
+        for (size_t i = 0; i < run; ++i) putLe(bytes + 2 * i, (uint16_t)samples[i], 2); // Little-endian on any host
+        if (fwrite(bytes, 2, run, file) != run) return false;
+        data_bytes += (uint32_t)(run * 2);
+        samples += run;
+        count -= run;
+    }
+    return true;
+}
+
+bool WavFile::close() {
+    if (file == NULL) return true;
+    bool ok = fseek(file, 0, SEEK_SET) == 0 && writeHeader();
+    ok = fclose(file) == 0 && ok;
+    file = NULL;
+    return ok;
+}
+
+void WavFile::sink(const int16_t* samples, size_t count, void* context) {
+    static_cast<WavFile*>(context)->write(samples, count);
+}
+
+bool WavFile::writeHeader() {
+    uint8_t header[44];
+    memcpy(header, "RIFF", 4);
+    putLe(header + 4, 36 + data_bytes, 4);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    putLe(header + 16, 16, 4);                          // fmt chunk size
+    putLe(header + 20, 1, 2);                           // PCM
+    putLe(header + 22, channels, 2);
+    putLe(header + 24, sample_rate, 4);
+    putLe(header + 28, sample_rate * channels * 2, 4);  // Byte rate
+    putLe(header + 32, channels * 2, 2);                // Block align
+    putLe(header + 34, 16, 2);                          // Bits per sample
+    memcpy(header + 36, "data", 4);
+    putLe(header + 40, data_bytes, 4);
+    return fwrite(header, sizeof(header), 1, file) == 1;
+}
+
+bool WavFile::makeDirectories(const char* path) {
+    std::string partial;
+    for (const char* c = path; ; ++c) {
+        if ((*c == '/' || *c == '\0') && !partial.empty() && partial.back() != '/') {
+            if (mkdir(partial.c_str(), 0777) != 0 && errno != EEXIST) return false;
+        }
+        if (*c == '\0') break;
+        partial += *c;
+    }
+    struct stat info;
+    return stat(path, &info) == 0 && S_ISDIR(info.st_mode);
+}
+
+std::string WavFile::fileName(const char* title) {
+    std::string name;
+    for (const char* c = title ? title : ""; *c; ++c) {
+        bool keep = (*c >= 'A' && *c <= 'Z') || (*c >= 'a' && *c <= 'z') || (*c >= '0' && *c <= '9');
+        if (keep) {
+            name += *c;
+        } else if (!name.empty() && name.back() != '_') {
+            name += '_';
+        }
+    }
+    while (!name.empty() && name.back() == '_') name.pop_back();
+    return name.empty() ? "untitled" : name;
+}
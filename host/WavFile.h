@@ -0,0 +1,36 @@
+#ifndef HOST_WAV_FILE_H
+#define HOST_WAV_FILE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// 16-bit PCM WAV writer for host renders. Samples are appended block by block
+// (interleaved when stereo); close() fills in the sizes.
+class WavFile {
+public:
+    WavFile() : file(NULL), data_bytes(0), channels(1), sample_rate(0) {}
+    ~WavFile() { close(); }
+
+    bool open(const char* path, uint32_t sample_rate, int channels);
+    bool write(const int16_t* samples, size_t count);
+    bool close();
+
+    // SongRenderer::SampleSink; context is the WavFile
+    static void sink(const int16_t* samples, size_t count, void* context);
+
+    // File name for a song title: letters and digits, other runs become one '_'
+    static std::string fileName(const char* title);
+    // Create a directory and any missing parents, like mkdir -p; true if it exists afterwards
+    static bool makeDirectories(const char* path);
+
+private:
+    FILE* file;
+    uint32_t data_bytes;
+    int channels;
+    uint32_t sample_rate;
+
+    bool writeHeader();
+};
+
+#endif // HOST_WAV_FILE_H
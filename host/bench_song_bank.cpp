@@ -0,0 +1,12 @@
+// One song bank generated by myMidiParse2.py --bank, for synth_benchmark. CMake
+// compiles this file once per bank, with BENCH_SONG_BANK set to the bank's header
+// and BENCH_SONG_BANK_LIST to the name of the function returning its song_list.
+// The song arrays and song_list are const, so every copy keeps its own.
+#include <Arduino.h>
+#include "SongFormat.h"
+#include BENCH_SONG_BANK
+
+const SongInfo* BENCH_SONG_BANK_LIST(uint16_t* count) {
+    *count = SONG_COUNT;
+    return song_list;
+}
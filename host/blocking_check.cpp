@@ -0,0 +1,91 @@
+// blocking_check: nothing that can block runs while voicesMutex is held. Starts the
+// synth's real render and output tasks with Synthesizer::init() (the host i2s_write
+// takes as long as its audio plays) and the deferred log task, then plays a song
+// through MidiPlayer::update() while a second task drives every other call that
+// takes the mutex, including more notes than voices and unplayable notes (both
+// warn from under the mutex). The host stand-ins count every call that can block
+// made while its task holds a mutex; any at all fails the test.
+//   blocking_check [--seconds N]
+#include <Arduino.h>
+#include "DeferredLog.h"
+#include "HostStubs.h"
+#include "MidiPlayer.h"
+#include "Synthesizer.h"
+#include "SongData.h"
+#include <atomic>
+#include <string>
+#include <thread>
+
+static Synthesizer synth;
+static MidiPlayer player;
+static std::atomic<bool> running(true);
+
+// A second "task" hammering the mutex from outside the player
+static void controlTask() {
+    unsigned long rounds = 0;
+    while (running) {
+        int channel = (int)(rounds % SYNTH_MIDI_CHANNEL_COUNT);
+        for (int i = 0; i < SYNTH_MAX_VOICES + 4; ++i) {
+            synth.startNote(84 + i, 100, channel); // The last few find no free voice
+        }
+        synth.startNote(SYNTH_MIDI_NOTE_COUNT + 1, 100, channel); // Cannot start note
+        synth.setChannelPan(channel, (int)(rounds * 13 % 128));
+        for (int i = 0; i < SYNTH_MAX_VOICES + 4; ++i) {
+            synth.stopNote(84 + i);
+        }
+        synth.startNoteOnVoice(SYNTH_MAX_VOICES - 1, 60, 100, channel);
+        synth.stopNoteOnVoice(SYNTH_MAX_VOICES - 1, 60);
+        synth.setOversampling(rounds % 2 ? 2 : 1);
+        if (rounds % 16 == 0) synth.resetControllers();
+        SynthStats stats;
+        synth.getStats(stats);
+        synth.outputLatencyMicros();
+        ++rounds;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned long run_ms = 1000;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--seconds" && i + 1 < argc) {
+            run_ms = (unsigned long)(atof(argv[++i]) * 1000);
+        } else {
+            fprintf(stderr, "usage: %s [--seconds N]\n", argv[0]);
+            return 2;
+        }
+    }
+    hostSerialEnable(false); // Still counted, just not printed
+    if (!synthLog.begin() || !synth.init()) {
+        fprintf(stderr, "Error: the synthesizer did not start\n");
+        return 1;
+    }
+    player.init(synth);
+    std::thread control(controlTask);
+
+    unsigned long start_ms = millis();
+    uint16_t song = 0;
+    while (millis() - start_ms < run_ms) {
+        if (!player.isPlaying()) {
+            if (!player.loadSong(&song_list[song++ % SONG_COUNT])) break;
+            player.start();
+        }
+        player.update();
+        delay(1);
+    }
+    running = false;
+    control.join();
+
+    SynthStats stats;
+    synth.getStats(stats);
+    const char* first_call = NULL;
+    unsigned long blocking_calls = hostBlockingCallsUnderMutex(&first_call);
+    printf("%lu render blocks, %lu blocking calls under the voices mutex%s%s\n", (unsigned long)stats.blocks,
+           blocking_calls, blocking_calls ? ", the first: " : "", blocking_calls ? first_call : "");
+    if (stats.blocks == 0) {
+        fprintf(stderr, "Error: the render task never ran\n");
+        return 1;
+    }
+    return blocking_calls == 0 ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+// fuzz_song: feed malformed songs to MidiPlayer::loadSong and play whatever it
+// accepts, built with AddressSanitizer and UndefinedBehaviorSanitizer. Anything
+// loadSong lets through has to play without reading outside the data array.
+// Songs are played by MidiPlayer::update() on the simulated host clock, started
+// shortly before millis() wraps, so its scheduling, its wrap-around comparison and
+// the latency it records run under the sanitizers too.
+//
+// An input is a song as the player sees it:
+//   byte 0      SONG_FORMAT_RAW or SONG_FORMAT_LZ
+//   bytes 1-4   event count, little endian
+//   bytes 5-    the data array; its length is SongInfo::data_size
+//
+// LLVMFuzzerTestOneInput is the libFuzzer entry point, so with clang the file can
+// be built with -fsanitize=fuzzer,address,undefined -DSYNTH_LIBFUZZER. Otherwise
+// main() replays the corpus and then runs random mutations of it:
+//   fuzz_song [--runs N] [--seed S] CORPUS_DIR...
+#include <Arduino.h>
+#include "Synthesizer.h"
+#include "MidiPlayer.h"
+#include "HostStubs.h"
+#include <dirent.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+static const size_t HEADER_BYTES = 5;
+static const uint32_t MAX_STEPS = 4096;     // Repeat records can expand a short input a lot
+static const size_t RENDER_SAMPLES = 8;     // Per event, so voice changes are rendered too
+static const uint64_t WRAP_LEAD_MS = 500;   // Song start before the 32-bit millis() wrap
+static const uint32_t LATE_US = 250;        // How late every event is dispatched
+
+static Synthesizer synth;
+static MidiPlayer player;
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* input, size_t size) {
+    static bool initialized = false;
+    if (!initialized) {
+        hostSerialEnable(false);
+        synth.initVoices();
+        player.init(synth);
+        initialized = true;
+    }
+    if (size < HEADER_BYTES) return 0;
+    uint32_t event_count = (uint32_t)input[1] | ((uint32_t)input[2] << 8) | ((uint32_t)input[3] << 16)
+                         | ((uint32_t)input[4] << 24);
+    // A heap copy of exactly data_size bytes, so the sanitizer sees every read past the end
+    size_t data_size = size - HEADER_BYTES;
+    uint8_t* data = new uint8_t[data_size ? data_size : 1];
+    memcpy(data, input + HEADER_BYTES, data_size);
+    SongInfo song(data_size ? data : NULL, event_count, 120.0f, input[0], "Fuzz", 0, (uint32_t)data_size);
+
+    if (player.loadSong(&song)) {
+        int16_t block[RENDER_SAMPLES];
+        hostSetClock(((1ULL << 32) - WRAP_LEAD_MS) * 1000 + LATE_US);
+        player.start();
+        player.resetLatencyStats();
+        for (uint32_t step = 0; step < MAX_STEPS; ++step) {
+            // Move the clock to the next event (if it is not already due), LATE_US past its ideal time
+            uint32_t wait_ms = (uint32_t)(player.nextEventTime() - millis());
+            if ((int32_t)wait_ms > 0) hostAdvanceClock((uint64_t)wait_ms * 1000);
+            uint32_t dispatched = player.dispatchLatency().count();
+            if (!player.update()) break;
+            // A due event has to be dispatched, on time as the clock says, whichever side of the wrap it is
+            if (player.dispatchLatency().count() != dispatched + 1 || player.dispatchLatency().max() != LATE_US) {
+                fprintf(stderr, "fuzz_song: update() at millis() %lu did not dispatch the event due at %lu "
+                        "(latency max %lu us)\n", millis(), player.nextEventTime(),
+                        (unsigned long)player.dispatchLatency().max());
+                abort();
+            }
+            synth.renderBlock(block, RENDER_SAMPLES);
+        }
+        player.stop();
+    }
+    synth.initVoices();
+    delete[] data;
+    return 0;
+}
+
+#ifndef SYNTH_LIBFUZZER
+
+static bool readFile(const std::string& path, std::vector<uint8_t>& data) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == NULL) return false;
+    uint8_t buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) data.insert(data.end(), buffer, buffer + count);
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+static bool readCorpus(const char* dir_path, std::vector<std::vector<uint8_t> >& corpus) {
+    DIR* dir = opendir(dir_path);
+    if (dir == NULL) return false;
+    std::vector<std::string> names;
+    while (struct dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') names.push_back(entry->d_name);
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end()); // Same order, same runs, for a given seed
+    for (size_t i = 0; i < names.size(); ++i) {
+        std::vector<uint8_t> data;
+        if (!readFile(std::string(dir_path) + "/" + names[i], data)) return false;
+        corpus.push_back(data);
+    }
+    return true;
+}
+
+// One to four edits, biased towards the fields loadSong has to check: the event
+// count, event type bytes and the length of the array
+static void mutate(std::vector<uint8_t>& input, const std::vector<std::vector<uint8_t> >& corpus,
+                   std::mt19937& random) {
+    static const uint8_t INTERESTING[] = { 0x00, 0x01, 0x02, 0x03, 0x0F, 0x10, 0x7F, 0x80, 0xF0, 0xFF };
+    int edits = 1 + random() % 4;
+    for (int e = 0; e < edits; ++e) {
+        size_t size = input.size();
+        size_t at = size ? random() % size : 0;
+        switch (random() % 8) {
+            case 0: if (size) input[at] ^= (uint8_t)(1 << (random() % 8)); break;
+            case 1: if (size) input[at] = (uint8_t)random(); break;
+            case 2: if (size) input[at] = INTERESTING[random() % sizeof(INTERESTING)]; break;
+            case 3: // Event count
+                if (size >= HEADER_BYTES) input[1 + random() % 4] = INTERESTING[random() % sizeof(INTERESTING)];
+                break;
+            case 4: // Type byte of some event
+                if (size > HEADER_BYTES + 2) {
+                    size_t event = (size - HEADER_BYTES) / SONG_BYTES_PER_EVENT;
+                    size_t index = HEADER_BYTES + (event ? random() % event : 0) * SONG_BYTES_PER_EVENT + 2;
+                    if (index < size) input[index] = (uint8_t)random();
+                }
+                break;
+            case 5: input.resize(size ? random() % size : 0); break;
+            case 6: // Duplicate a run of bytes
+                if (size) {
+                    size_t length = 1 + random() % std::min<size_t>(size - at, 64);
+                    std::vector<uint8_t> run(input.begin() + at, input.begin() + at + length);
+                    input.insert(input.begin() + random() % (size + 1), run.begin(), run.end());
+                }
+                break;
+            default: { // Splice in part of another input
+                const std::vector<uint8_t>& other = corpus[random() % corpus.size()];
+                if (other.empty()) break;
+                size_t from = random() % other.size();
+                size_t length = 1 + random() % std::min<size_t>(other.size() - from, 256);
+                input.insert(input.begin() + (size ? random() % size : 0), other.begin() + from,
+                             other.begin() + from + length);
+                break;
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned long runs = 10000;
+    unsigned long seed = 1;
+    std::vector<std::vector<uint8_t> > corpus;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--runs" && i + 1 < argc) {
+            runs = strtoul(argv[++i], NULL, 10);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = strtoul(argv[++i], NULL, 10);
+        } else if (arg[0] == '-' || !readCorpus(argv[i], corpus)) {
+            fprintf(stderr, "usage: %s [--runs N] [--seed S] CORPUS_DIR...\n", argv[0]);
+            return 2;
+        }
+    }
+    if (corpus.empty()) {
+        fprintf(stderr, "Error: empty corpus\n");
+        return 2;
+    }
+
+    for (size_t i = 0; i < corpus.size(); ++i) {
+        LLVMFuzzerTestOneInput(corpus[i].data(), corpus[i].size());
+    }
+    std::mt19937 random(seed);
+    std::vector<uint8_t> input;
+    for (unsigned long run = 0; run < runs; ++run) {
+        input = corpus[random() % corpus.size()];
+        mutate(input, corpus, random);
+        LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+    printf("fuzz_song: %u corpus inputs and %lu mutations (seed %lu), no errors\n", (unsigned)corpus.size(), runs, seed);
+    return 0;
+}
+
+#endif // SYNTH_LIBFUZZER
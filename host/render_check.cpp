@@ -0,0 +1,52 @@
+// render_check: the sketch's golden-render check (RenderCheck.cpp) as a host test.
+// Runs runRenderCheck on the songs in SongData.h and exits non-zero on any
+// mismatch. With -o DIR, every song that fails is written to DIR/<title>.wav so
+// the change can be listened to or diffed against a good render.
+//   render_check [-o DIR] [--output-rate HZ]
+#include <Arduino.h>
+#include "RenderCheck.h"
+#include "WavFile.h"
+#include "SongData.h"
+#include <string>
+
+struct WavDump {
+    const char* dir;
+    WavFile wav;
+};
+
+static bool openDump(const char* title, uint32_t sample_rate, int channels, void* context) {
+    WavDump* dump = static_cast<WavDump*>(context);
+    std::string path = std::string(dump->dir) + "/" + WavFile::fileName(title) + ".wav";
+    if (!dump->wav.open(path.c_str(), sample_rate, channels)) {
+        fprintf(stderr, "Error: cannot write %s\n", path.c_str());
+        return false;
+    }
+    printf("Failing render written to %s\n", path.c_str());
+    return true;
+}
+
+static void writeDump(const int16_t* samples, size_t count, void* context) {
+    static_cast<WavDump*>(context)->wav.write(samples, count);
+}
+
+static void closeDump(void* context) {
+    static_cast<WavDump*>(context)->wav.close();
+}
+
+int main(int argc, char** argv) {
+    WavDump wav_dump = { NULL, WavFile() };
+    float output_rate = SYNTH_SAMPLE_RATE;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            wav_dump.dir = argv[++i];
+        } else if (arg == "--output-rate" && i + 1 < argc) {
+            output_rate = (float)atof(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [-o DIR] [--output-rate HZ]\n", argv[0]);
+            return 2;
+        }
+    }
+    RenderDump dump = { openDump, writeDump, closeDump, &wav_dump };
+    return runRenderCheck(song_list, SONG_COUNT, output_rate, wav_dump.dir ? &dump : nullptr) ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host stand-in for the parts of the ESP32 Arduino core the synth uses, so the
+// sketch sources build and run on a PC (see CMakeLists.txt at the repository root).
+// Serial goes to stdout, time comes from the steady clock, and the cycle counter
+// runs at the nominal CPU clock in nanosecond steps.
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "pgmspace.h"
+
+#define PI 3.1415926535897932384626433832795
+#define TWO_PI 6.283185307179586476925286766559
+
+class HardwareSerial {
+public:
+    void begin(unsigned long) {}
+    operator bool() const { return true; }
+    size_t print(const char* text);
+    size_t println(const char* text = "");
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    void flush();
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getCycleCount();
+    uint32_t getCpuFreqMHz() { return 240; }
+};
+extern EspClass ESP;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+bool psramFound();
+uint32_t esp_random();
+void randomSeed(unsigned long seed);
+long random(long max);
+
+template <class T, class L, class H>
+T constrain(T value, L low, H high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+#endif // HOST_ARDUINO_H
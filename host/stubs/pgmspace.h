@@ -0,0 +1,14 @@
+#ifndef HOST_PGMSPACE_H
+#define HOST_PGMSPACE_H
+
+// Flash and RAM share one address space on the host, as on the ESP32
+#define PROGMEM
+#define pgm_read_byte_near(address) (*(const uint8_t*)(address))
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define pgm_read_word_near(address) (*(const uint16_t*)(address))
+#define pgm_read_dword_near(address) (*(const uint32_t*)(address))
+#define pgm_read_float_near(address) (*(const float*)(address))
+#define pgm_read_ptr_near(address) (*(const void* const*)(address))
+#define memcpy_P memcpy
+
+#endif // HOST_PGMSPACE_H
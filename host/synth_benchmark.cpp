@@ -0,0 +1,58 @@
+// synth_benchmark: the sketch's benchmarks (SynthBenchmark.cpp) on the host, for
+// the "BENCH " lines without flashing a board. CMake builds it with
+// SYNTH_VOICES=SYNTH_BENCHMARK_VOICES (64 by default), so the "render" line sweeps
+// 1 to 64 active voices. Host timings only show trends: the cycle counter is the
+// steady clock scaled to 240 MHz. There is no audio task either, so the "live"
+// note timings are uncontended. millis() and micros() are simulated, which lets the "song"
+// lines time MidiPlayer::update() per event.
+//
+// With Python and mido at configure time, the "song" lines are repeated for the
+// converter's example songs LZ-compressed (timing the device's LzStreamDecoder on
+// every compressed song) and with repeat records.
+//   synth_benchmark            # only the BENCH lines on stdout
+//   synth_benchmark --log      # the synth's log as well
+#include <Arduino.h>
+#include "HostStubs.h"
+#include "Synthesizer.h"
+#include "SynthBenchmark.h"
+#include "SongData.h"
+#include <string>
+
+#if SYNTH_BENCH_BANKS
+// bench_song_bank.cpp, with myMidiParse2.py --bank --compress and --bank --patterns
+const SongInfo* lzSongBank(uint16_t* count);
+const SongInfo* patternSongBank(uint16_t* count);
+#endif
+
+static Synthesizer synth;
+
+static void advanceClock(unsigned long ms) {
+    hostAdvanceClock((uint64_t)ms * 1000);
+}
+
+int main(int argc, char** argv) {
+    bool log = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--log") {
+            log = true;
+        } else {
+            fprintf(stderr, "usage: %s [--log]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (!log) hostSerialOnlyLines("BENCH ");
+    hostSetClock(0);
+    if (!synth.initVoices()) {
+        fprintf(stderr, "Error: the synthesizer did not start\n");
+        return 1;
+    }
+    runSynthBenchmarks(synth, song_list, SONG_COUNT, advanceClock);
+#if SYNTH_BENCH_BANKS
+    uint16_t count;
+    const SongInfo* songs = lzSongBank(&count);
+    runSongBenchmarks(songs, count, advanceClock);
+    songs = patternSongBank(&count);
+    runSongBenchmarks(songs, count, advanceClock);
+#endif
+    return 0;
+}
@@ -0,0 +1,349 @@
+// synth_render: render songs on the host with the sketch's own Synthesizer,
+// MidiPlayer and SongRenderer, to WAV files and the golden hashes RenderCheck.cpp
+// records. Also measures pitch accuracy per sample rate and aliasing per
+// oversampling factor. Run with --help for the options.
+#include <Arduino.h>
+#include "Synthesizer.h"
+#include "MidiPlayer.h"
+#include "SongRenderer.h"
+#include "RenderCheck.h"
+#include "HalfBandDecimator.h"
+#include "HostStubs.h"
+#include "WavFile.h"
+#include <chrono>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+#ifndef SYNTH_SONG_HEADER
+#define SYNTH_SONG_HEADER "SongData.h" // Or a SongBank.h from myMidiParse2.py --bank (without --bin)
+#endif
+#include SYNTH_SONG_HEADER
+
+static Synthesizer synth; // Offline: no I2S, no audio task
+static MidiPlayer player;
+
+struct Options {
+    const char* out_dir = NULL;
+    const char* song_path = NULL;
+    float bpm = 0.0f; // 0: the .mid's own tempo, or 120 for a .bin
+    uint32_t lz_events = 0;
+    int channels = 1;
+    uint32_t sample_rate = SYNTH_SAMPLE_RATE;
+    int oversampling = 1;
+};
+
+struct RenderSink {
+    uint32_t hash;
+    WavFile* wav;
+    std::vector<int16_t>* samples;
+};
+
+static void renderSink(const int16_t* samples, size_t count, void* context) {
+    RenderSink* sink = static_cast<RenderSink*>(context);
+    sink->hash = hashRenderedSamples(sink->hash, samples, count);
+    if (sink->wav) sink->wav->write(samples, count);
+    if (sink->samples) sink->samples->insert(sink->samples->end(), samples, samples + count);
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Render one song at the current rate and oversampling; returns frames, or 0 if it does not load
+static uint32_t renderSong(const SongInfo* song, int channels, RenderSink* sink) {
+    synth.initVoices();
+    if (!player.loadSong(song)) return 0;
+    return SongRenderer::render(synth, player, renderSink, sink, channels);
+}
+
+static bool renderToWav(const SongInfo* song, const Options& options) {
+    const char* title = song->title ? song->title : "(untitled)";
+    WavFile wav;
+    std::string wav_path;
+    if (options.out_dir) {
+        if (!WavFile::makeDirectories(options.out_dir)) {
+            fprintf(stderr, "Error: cannot create %s\n", options.out_dir);
+            return false;
+        }
+        wav_path = std::string(options.out_dir) + "/" + WavFile::fileName(song->title) + ".wav";
+        if (!wav.open(wav_path.c_str(), options.sample_rate, options.channels)) {
+            fprintf(stderr, "Error: cannot write %s\n", wav_path.c_str());
+            return false;
+        }
+    }
+    RenderSink sink = { RENDER_HASH_BASIS, options.out_dir ? &wav : NULL, NULL };
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    uint32_t frames = renderSong(song, options.channels, &sink);
+    double elapsed = secondsSince(start);
+    if (frames == 0) {
+        fprintf(stderr, "Error: %s did not load\n", title);
+        return false;
+    }
+    if (!wav.close()) {
+        fprintf(stderr, "Error: cannot write %s\n", wav_path.c_str());
+        return false;
+    }
+    double seconds = (double)frames / options.sample_rate;
+    printf("%s: %.1fs rendered in %.3fs (%.0fx real time), %lu %s, hash 0x%08lx%s%s\n", title, seconds, elapsed,
+           elapsed > 0 ? seconds / elapsed : 0.0, (unsigned long)frames, options.channels == 2 ? "frames" : "samples",
+           (unsigned long)sink.hash, options.out_dir ? " -> " : "", wav_path.c_str());
+    return true;
+}
+
+static bool readFile(const char* path, std::vector<uint8_t>& data) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return false;
+    uint8_t buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) data.insert(data.end(), buffer, buffer + count);
+    bool ok = !ferror(file);
+    fclose(file);
+    return ok;
+}
+
+static std::string shellQuote(const char* text) {
+    std::string quoted = "'";
+    for (const char* c = text; *c; ++c) quoted += *c == '\'' ? std::string("'\\''") : std::string(1, *c);
+    return quoted + "'";
+}
+
+// Convert a .mid with myMidiParse2.py --raw-output into a raw event stream and its tempo
+static bool convertMidi(const char* midi_path, std::vector<uint8_t>& data, float* bpm) {
+#if defined(SYNTH_PYTHON) && defined(SYNTH_CONVERTER)
+    char raw_path[] = "/tmp/synth_render_XXXXXX";
+    int fd = mkstemp(raw_path);
+    if (fd < 0) return false;
+    close(fd);
+    std::string command = shellQuote(SYNTH_PYTHON) + " " + shellQuote(SYNTH_CONVERTER) + " " + shellQuote(midi_path) +
+                          " --raw-output " + shellQuote(raw_path);
+    FILE* converter = popen(command.c_str(), "r");
+    if (converter == NULL) {
+        unlink(raw_path);
+        return false;
+    }
+    std::string report; // Read to the end: closing the pipe early would fail the converter's print
+    char buffer[256];
+    while (fgets(buffer, sizeof(buffer), converter)) report += buffer;
+    unsigned long events = 0;
+    bool ok = pclose(converter) == 0 && sscanf(report.c_str(), "%lu events at %f BPM", &events, bpm) == 2;
+    ok = ok && readFile(raw_path, data) && data.size() == events * SONG_BYTES_PER_EVENT;
+    unlink(raw_path);
+    return ok;
+#else
+    (void)midi_path; (void)data; (void)bpm;
+    fprintf(stderr, "Error: built without Python, convert with myMidiParse2.py --raw-output and pass the .bin\n");
+    return false;
+#endif
+}
+
+static bool endsWith(const std::string& text, const char* suffix) {
+    size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+// A two-event song: note on voice 0, note off 192 ticks (1 s at 120 BPM) later
+struct ToneSong {
+    uint8_t data[2 * SONG_BYTES_PER_EVENT];
+    SongInfo info;
+
+    explicit ToneSong(uint8_t note) : info(data, 2, 120.0f, SONG_FORMAT_RAW, "Tone", 1000, sizeof(data)) {
+        const uint8_t events[] = {
+            0, 0,   0x10 | SONG_EVENT_NOTE_ON, note, 127, 0,
+            0, 192, 0x10 | SONG_EVENT_NOTE_OFF, note, 0, 0,
+        };
+        memcpy(data, events, sizeof(data));
+    }
+};
+
+// Render one second of every A from A1 to A7 at each sample rate and measure the
+// pitch from the rising edges. A square wave half-period is a whole number of
+// samples, so a note may be off by up to half a sample per half-period; anything
+// beyond that means the pitch table does not match the rate.
+static bool pitchCheck() {
+    bool ok = true;
+    printf("%6s %10s %11s %7s\n", "rate", "max cents", "worst note", "result");
+    for (size_t r = 0; r < sizeof(SYNTH_SUPPORTED_SAMPLE_RATES) / sizeof(SYNTH_SUPPORTED_SAMPLE_RATES[0]); ++r) {
+        uint32_t rate = SYNTH_SUPPORTED_SAMPLE_RATES[r];
+        synth.setSampleRate((float)rate);
+        double worst_cents = 0.0;
+        int worst_note = 0;
+        bool rate_ok = true;
+        for (int note = 33; note < 106; note += 12) {
+            ToneSong tone((uint8_t)note);
+            std::vector<int16_t> samples;
+            RenderSink sink = { RENDER_HASH_BASIS, NULL, &samples };
+            renderSong(&tone.info, 1, &sink);
+            std::vector<size_t> edges;
+            for (size_t i = 1; i < samples.size(); ++i) {
+                if (samples[i - 1] < 0 && samples[i] > 0) edges.push_back(i);
+            }
+            double ideal = 440.0 * pow(2.0, (note - 69) / 12.0);
+            double measured = edges.size() > 1 ? (double)rate * (edges.size() - 1) / (edges.back() - edges.front()) : 0.0;
+            double cents = measured > 0 ? 1200.0 * log2(measured / ideal) : INFINITY;
+            double half_period = rate / (2.0 * ideal);
+            double bound = 1200.0 * log2((half_period + 0.5) / half_period) + 0.01;
+            if (fabs(cents) > bound) rate_ok = false;
+            if (fabs(cents) >= fabs(worst_cents)) {
+                worst_cents = cents;
+                worst_note = note;
+            }
+        }
+        printf("%6lu %+10.1f %11d %7s\n", (unsigned long)rate, worst_cents, worst_note, rate_ok ? "pass" : "FAIL");
+        ok = ok && rate_ok;
+    }
+    synth.setSampleRate((float)SYNTH_SAMPLE_RATE);
+    return ok;
+}
+
+// Render one second of C5, C6, C7 and C8 at full velocity at every oversampling
+// factor and compare each with the alias-free signal the synth is aiming for: the
+// played square wave band-limited to the output Nyquist, shaped by the decimation
+// filters' passband and sampled where each output is centered. The difference is
+// what the naive square wave folded back below Nyquist (plus int16 rounding).
+// Prints the error relative to the signal in dB.
+static void aliasCheck(uint32_t sample_rate) {
+    static const int NOTES[] = { 72, 84, 96, 108 };
+    static const int FACTORS[] = { 1, 2, SYNTH_MAX_OVERSAMPLING };
+    const int settle = 64; // Output samples before the filters see only the note
+    synth.setSampleRate((float)sample_rate);
+    printf("%5s %7s", "note", "Hz");
+    for (int factor : FACTORS) printf("%6dx dB", factor);
+    printf("\n");
+    for (int note : NOTES) {
+        printf("%5d %7.0f", note, 440.0 * pow(2.0, (note - 69) / 12.0));
+        for (int factor : FACTORS) {
+            synth.setOversampling(factor);
+            ToneSong tone((uint8_t)note);
+            std::vector<int16_t> samples;
+            RenderSink sink = { RENDER_HASH_BASIS, NULL, &samples };
+            renderSong(&tone.info, 1, &sink);
+
+            // Half-period in voice-rate samples, worked out as Synthesizer::calculate_wavelength does
+            float frequency = 440.0f * powf(2.0f, (float)(note - 69) / 12.0f);
+            int wavelength = (int)roundf((float)sample_rate * factor / (frequency * 2.0f));
+            if (wavelength < 1) wavelength = 1;
+            double omega = M_PI / wavelength; // Fundamental, radians per voice-rate sample
+            // Decimation stages from the voice rate down, as Synthesizer::decimate_unsafe
+            std::vector<HalfBandDecimator::Filter> stages;
+            if (factor == SYNTH_MAX_OVERSAMPLING) stages.push_back(HalfBandDecimator::FILTER_SHORT);
+            if (factor > 1) stages.push_back(HalfBandDecimator::FILTER_SHARP);
+            // Voice-rate sample each output is centered on, and the harmonics below the output Nyquist
+            int delay = 0;
+            for (size_t s = stages.size(); s-- > 0;) delay = 2 * delay + HalfBandDecimator::delay(stages[s]);
+            std::vector<double> harmonic_omega, harmonic_amplitude;
+            for (int k = 1; k < 2 * wavelength && k * factor < wavelength; k += 2) {
+                double gain = 1.0;
+                for (size_t s = 0; s < stages.size(); ++s) {
+                    gain *= HalfBandDecimator::response(stages[s], k * omega * (1 << s));
+                }
+                int sign = k % 4 == 1 ? 1 : -1;
+                harmonic_omega.push_back(k * omega);
+                harmonic_amplitude.push_back(sign * 4.0 * SYNTH_MAX_NOTE_AMPLITUDE / (M_PI * k) * gain);
+            }
+            // The voice is high for samples 0 .. wavelength - 1: edges at -0.5 and wavelength - 0.5
+            double middle = (wavelength - 1) / 2.0;
+            double error = 0.0, signal = 0.0;
+            for (size_t n = settle; n + settle < samples.size(); ++n) {
+                double t = (double)n * factor - delay - middle;
+                double ideal = 0.0;
+                for (size_t h = 0; h < harmonic_omega.size(); ++h) ideal += harmonic_amplitude[h] * cos(harmonic_omega[h] * t);
+                error += (samples[n] - ideal) * (samples[n] - ideal);
+                signal += ideal * ideal;
+            }
+            printf("%9.1f", 10.0 * log10(error / signal));
+        }
+        printf("\n");
+    }
+    synth.setOversampling(1);
+    synth.setSampleRate((float)SYNTH_SAMPLE_RATE);
+}
+
+static void usage(const char* program) {
+    printf("Usage: %s [options]\n"
+           "Render the songs in %s (or --song) with the sketch's synth and print their golden hashes.\n"
+           "  -o DIR              also write one WAV per song into DIR (created if missing)\n"
+           "  --song FILE         render FILE instead: a .mid (run through myMidiParse2.py --raw-output) or a raw\n"
+           "                      event stream (a songs/*.bin from myMidiParse2.py --bank --bin)\n"
+           "  --bpm BPM           tempo for --song (default: the .mid's own, 120 for a .bin)\n"
+           "  --lz EVENTS         --song is LZ-compressed (--compress) and holds EVENTS events\n"
+           "  --stereo            render panned stereo like the device's stereo output\n"
+           "  --sample-rate HZ    one of the rates in SYNTH_SUPPORTED_SAMPLE_RATES (default %d)\n"
+           "  --oversampling N    voice rate multiple, 1, 2 or 4, as SynthOutputConfig::oversampling\n"
+           "  --pitch-check       check the pitch of test notes at every supported sample rate\n"
+           "  --alias-check       measure the aliasing of high notes at each oversampling factor\n"
+           "  -v                  show the synth's own Serial log\n",
+           program, SYNTH_SONG_HEADER, SYNTH_SAMPLE_RATE);
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    bool pitch = false, alias = false, verbose = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "-o" && has_value) {
+            options.out_dir = argv[++i];
+        } else if (arg == "--song" && has_value) {
+            options.song_path = argv[++i];
+        } else if (arg == "--bpm" && has_value) {
+            options.bpm = (float)atof(argv[++i]);
+        } else if (arg == "--lz" && has_value) {
+            options.lz_events = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (arg == "--stereo") {
+            options.channels = 2;
+        } else if (arg == "--sample-rate" && has_value) {
+            options.sample_rate = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (arg == "--oversampling" && has_value) {
+            options.oversampling = atoi(argv[++i]);
+        } else if (arg == "--pitch-check") {
+            pitch = true;
+        } else if (arg == "--alias-check") {
+            alias = true;
+        } else if (arg == "-v") {
+            verbose = true;
+        } else {
+            usage(argv[0]);
+            return arg == "-h" || arg == "--help" ? 0 : 2;
+        }
+    }
+    if (!Synthesizer::isSupportedSampleRate(options.sample_rate) || !synth.setOversampling(options.oversampling)) {
+        fprintf(stderr, "Error: unsupported --sample-rate or --oversampling\n");
+        return 2;
+    }
+
+    hostSerialEnable(verbose);
+    if (!synth.initVoices()) return 1;
+    player.init(synth);
+    if (pitch) return pitchCheck() ? 0 : 1;
+    if (alias) {
+        aliasCheck(options.sample_rate);
+        return 0;
+    }
+    synth.setSampleRate((float)options.sample_rate);
+
+    if (options.song_path) {
+        std::vector<uint8_t> data;
+        float bpm = 120.0f;
+        if (endsWith(options.song_path, ".mid")) {
+            if (options.lz_events || !convertMidi(options.song_path, data, &bpm) || data.empty()) {
+                fprintf(stderr, "Error: cannot convert %s\n", options.song_path);
+                return 1;
+            }
+        } else if (!readFile(options.song_path, data) || data.empty()) {
+            fprintf(stderr, "Error: cannot read %s\n", options.song_path);
+            return 1;
+        }
+        if (options.bpm > 0) bpm = options.bpm;
+        const char* title = strrchr(options.song_path, '/') ? strrchr(options.song_path, '/') + 1 : options.song_path;
+        uint32_t events = options.lz_events ? options.lz_events : (uint32_t)(data.size() / SONG_BYTES_PER_EVENT);
+        SongInfo song = { data.data(), events, bpm, (uint8_t)(options.lz_events ? SONG_FORMAT_LZ : SONG_FORMAT_RAW),
+                          title, 0, (uint32_t)data.size() };
+        return renderToWav(&song, options) ? 0 : 1;
+    }
+    bool ok = true;
+    for (uint16_t i = 0; i < SONG_COUNT; ++i) {
+        ok = renderToWav(&song_list[i], options) && ok;
+    }
+    return ok ? 0 : 1;
+}
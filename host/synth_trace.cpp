@@ -0,0 +1,68 @@
+// synth_trace: the SYNTH_TRACE flight recorder on the host. Plays a song from
+// SongData.h on the synth's real render and output tasks (Synthesizer::init(), with
+// the host i2s_write taking as long as its audio plays) for a while, then writes
+// SYNTH_TRACE_DUMP() to a file instead of the serial log. CMake builds it with
+// SYNTH_TRACE=1; the dump holds the last SynthTrace::RING_SIZE entries.
+//   synth_trace [-o FILE] [--song N] [--seconds S]
+//   python _MyMidiParser/traceToChrome.py FILE -o trace.json
+#include <Arduino.h>
+#include "DeferredLog.h"
+#include "HostStubs.h"
+#include "MidiPlayer.h"
+#include "Synthesizer.h"
+#include "SynthTrace.h"
+#include "SongData.h"
+#include <string>
+
+static Synthesizer synth;
+static MidiPlayer player;
+
+int main(int argc, char** argv) {
+    const char* path = "trace.log";
+    int song = 0;
+    unsigned long run_ms = 1000;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            path = argv[++i];
+        } else if (arg == "--song" && i + 1 < argc) {
+            song = atoi(argv[++i]);
+        } else if (arg == "--seconds" && i + 1 < argc) {
+            run_ms = (unsigned long)(atof(argv[++i]) * 1000);
+        } else {
+            fprintf(stderr, "usage: %s [-o FILE] [--song N] [--seconds S]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (song < 0 || song >= SONG_COUNT) {
+        fprintf(stderr, "Error: --song %d, there are %u songs\n", song, SONG_COUNT);
+        return 2;
+    }
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        fprintf(stderr, "Error: cannot write %s\n", path);
+        return 1;
+    }
+
+    hostSerialEnable(false);
+    if (!synthLog.begin() || !synth.init()) {
+        fprintf(stderr, "Error: the synthesizer did not start\n");
+        return 1;
+    }
+    player.init(synth);
+    if (!player.loadSong(&song_list[song])) return 1;
+    player.start();
+    unsigned long start_ms = millis();
+    while (millis() - start_ms < run_ms && player.update()) {
+        delay(1);
+    }
+
+    hostSerialRedirect(file);
+    hostSerialEnable(true);
+    SYNTH_TRACE_DUMP();
+    hostSerialEnable(false); // The audio tasks keep running until exit
+    hostSerialRedirect(NULL);
+    fclose(file);
+    printf("Trace of %s written to %s\n", song_list[song].title, path);
+    return 0;
+}
@@ -0,0 +1,56 @@
+// trace_overhead: what the SYNTH_TRACE flight recorder costs the audio path. CMake
+// builds this file twice, as trace_overhead against synth_host_trace (SYNTH_TRACE=1)
+// and as trace_overhead_baseline against synth_host (SYNTH_TRACE=0). Each prints
+// SynthBenchmark's "block_path" line; given the baseline, trace_overhead runs it
+// too and prints the difference as a percentage of the render block's budget.
+// Host timings only show trends (see synth_benchmark.cpp).
+//   trace_overhead [--baseline PATH_TO_trace_overhead_baseline]
+#include <Arduino.h>
+#include "HostStubs.h"
+#include "Synthesizer.h"
+#include "SynthBenchmark.h"
+#include "SynthTrace.h"
+#include <cstring>
+#include <string>
+
+// ns per block from the baseline's "block_path" line, 0 if it did not run
+static uint32_t runBaseline(const char* path) {
+    std::string command = std::string("'") + path + "'";
+    FILE* baseline = popen(command.c_str(), "r");
+    if (baseline == NULL) return 0;
+    std::string output;
+    char buffer[256];
+    while (fgets(buffer, sizeof(buffer), baseline)) output += buffer;
+    if (pclose(baseline) != 0) return 0;
+    const char* field = strstr(output.c_str(), "\"ns_per_block\":");
+    return field ? (uint32_t)strtoul(field + strlen("\"ns_per_block\":"), NULL, 10) : 0;
+}
+
+int main(int argc, char** argv) {
+    const char* baseline_path = NULL;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--baseline" && i + 1 < argc && SYNTH_TRACE) {
+            baseline_path = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s%s\n", argv[0], SYNTH_TRACE ? " [--baseline PATH]" : "");
+            return 2;
+        }
+    }
+
+    uint32_t baseline_ns = 0;
+    if (baseline_path && (baseline_ns = runBaseline(baseline_path)) == 0) {
+        fprintf(stderr, "Error: no block_path result from %s\n", baseline_path);
+        return 1;
+    }
+    hostSerialOnlyLines("BENCH ");
+    uint32_t traced_ns = runBlockPathBenchmark();
+    if (traced_ns == 0) return 1;
+    if (baseline_path) {
+        double budget_ns = (double)SYNTH_RENDER_BLOCK_SAMPLES * 1e9 / SYNTH_SAMPLE_RATE;
+        printf("BENCH {\"bench\":\"trace_overhead\",\"ns_per_block_off\":%lu,\"ns_per_block_on\":%lu,"
+               "\"overhead_ns\":%ld,\"overhead_budget_percent\":%.3f}\n", (unsigned long)baseline_ns, (unsigned long)traced_ns,
+               (long)traced_ns - (long)baseline_ns, 100.0 * ((double)traced_ns - baseline_ns) / budget_ns);
+    }
+    return 0;
+}